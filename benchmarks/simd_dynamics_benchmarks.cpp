@@ -0,0 +1,36 @@
+#include "benchmark_helpers.hpp"
+
+#include "../simd_dynamics.hpp"
+
+static const unsigned int block_size = 64;
+static const unsigned int channels = 2;
+static const unsigned int lookahead = 64;
+
+void __noinline__ bench_1(nova::lookahead_limiter<float> & limiter, float * const * out, const float * const * in)
+{
+    limiter.process(out, in, block_size);
+}
+
+void __noinline__ bench_2(nova::lookahead_limiter<float> & limiter, float * const * out, const float * const * in)
+{
+    limiter.process_simd(out, in, block_size);
+}
+
+int main(void)
+{
+    const int iterations = 1000000;
+    nova::aligned_array<float, channels * block_size> in_buffer;
+    nova::aligned_array<float, channels * block_size> out_buffer;
+    fill_container(in_buffer);
+    fill_container(out_buffer);
+
+    const float * in[channels] = { in_buffer.begin(), in_buffer.begin() + block_size };
+    float * out[channels] = { out_buffer.begin(), out_buffer.begin() + block_size };
+
+    nova::lookahead_limiter<float> scalar(channels, lookahead, block_size), simd(channels, lookahead, block_size);
+    scalar.set_ceiling(0.5f);
+    simd.set_ceiling(0.5f);
+
+    run_bench(boost::bind(bench_1, boost::ref(scalar), out, in), iterations);
+    run_bench(boost::bind(bench_2, boost::ref(simd), out, in), iterations);
+}
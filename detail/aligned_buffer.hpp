@@ -0,0 +1,144 @@
+//  aligned buffer for stateful simd processors
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef NOVA_SIMD_DETAIL_ALIGNED_BUFFER_HPP
+#define NOVA_SIMD_DETAIL_ALIGNED_BUFFER_HPP
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
+
+namespace nova {
+namespace detail {
+
+/* cache-line alignment, which covers the alignment requirements of all vec types */
+const std::size_t buffer_alignment = 64;
+
+inline void * allocate_aligned(std::size_t nbytes)
+{
+#ifdef _MSC_VER
+    void * ret = _aligned_malloc(nbytes, buffer_alignment);
+#else
+    void * ret;
+    if (posix_memalign(&ret, buffer_alignment, nbytes))
+        ret = 0;
+#endif
+    if (!ret)
+        throw std::bad_alloc();
+    return ret;
+}
+
+inline void free_aligned(void * ptr)
+{
+#ifdef _MSC_VER
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+/* zero-initialized, cache-line aligned array of scalars */
+template <typename T>
+class aligned_buffer
+{
+    aligned_buffer(aligned_buffer const &);
+    aligned_buffer & operator=(aligned_buffer const &);
+
+public:
+    aligned_buffer(void):
+        data_(0), size_(0)
+    {}
+
+    explicit aligned_buffer(std::size_t size):
+        data_(0), size_(0)
+    {
+        resize(size);
+    }
+
+    ~aligned_buffer(void)
+    {
+        if (data_)
+            free_aligned(data_);
+    }
+
+    /* discards the old content */
+    void resize(std::size_t size)
+    {
+        T * data = size ? static_cast<T*>(allocate_aligned(size * sizeof(T))) : 0;
+
+        if (data_)
+            free_aligned(data_);
+        data_ = data;
+        size_ = size;
+        clear();
+    }
+
+    void clear(void)
+    {
+        if (size_)
+            std::memset(data_, 0, size_ * sizeof(T));
+    }
+
+    void swap(aligned_buffer & rhs)
+    {
+        T * data = data_;
+        std::size_t size = size_;
+        data_ = rhs.data_;
+        size_ = rhs.size_;
+        rhs.data_ = data;
+        rhs.size_ = size;
+    }
+
+    T * data(void)
+    {
+        return data_;
+    }
+
+    const T * data(void) const
+    {
+        return data_;
+    }
+
+    T & operator[](std::size_t index)
+    {
+        return data_[index];
+    }
+
+    T operator[](std::size_t index) const
+    {
+        return data_[index];
+    }
+
+    std::size_t size(void) const
+    {
+        return size_;
+    }
+
+private:
+    T * data_;
+    std::size_t size_;
+};
+
+} /* namespace detail */
+} /* namespace nova */
+
+#endif /* NOVA_SIMD_DETAIL_ALIGNED_BUFFER_HPP */
@@ -164,6 +164,127 @@ private:
     }
 };
 
+/* functors with two outputs, called as f(out0, out1, args...) */
+template <typename Functor>
+struct dual_output_functor
+{
+    template <typename FloatType, typename Arg1Type, typename Arg2Type>
+    static always_inline void perform_vec(FloatType * out0, FloatType * out1, Arg1Type arg1, Arg2Type arg2, unsigned int n)
+    {
+        nova::detail::apply_on_vector_dual(out0, out1, wrap_argument(arg1), wrap_argument(arg2), n, Functor());
+    }
+
+    template <typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type, typename Arg4Type>
+    static always_inline void perform_vec(FloatType * out0, FloatType * out1, Arg1Type arg1, Arg2Type arg2,
+                                          Arg3Type arg3, Arg4Type arg4, unsigned int n)
+    {
+        nova::detail::apply_on_vector_dual(out0, out1, wrap_argument(arg1), wrap_argument(arg2),
+                                           wrap_argument(arg3), wrap_argument(arg4), n, Functor());
+    }
+
+    template <typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type, typename Arg4Type,
+              typename Arg5Type, typename Arg6Type>
+    static always_inline void perform_vec(FloatType * out0, FloatType * out1, Arg1Type arg1, Arg2Type arg2,
+                                          Arg3Type arg3, Arg4Type arg4, Arg5Type arg5, Arg6Type arg6, unsigned int n)
+    {
+        nova::detail::apply_on_vector_dual(out0, out1, wrap_argument(arg1), wrap_argument(arg2),
+                                           wrap_argument(arg3), wrap_argument(arg4),
+                                           wrap_argument(arg5), wrap_argument(arg6), n, Functor());
+    }
+
+    template <typename FloatType, typename Arg1Type, typename Arg2Type>
+    static always_inline void perform_vec_simd(FloatType * out0, FloatType * out1, Arg1Type arg1, Arg2Type arg2, unsigned int n)
+    {
+        nova::detail::generate_dual_simd_loop(out0, out1,
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg1)),
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg2)),
+                                              n, Functor());
+    }
+
+    template <typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type, typename Arg4Type>
+    static always_inline void perform_vec_simd(FloatType * out0, FloatType * out1, Arg1Type arg1, Arg2Type arg2,
+                                               Arg3Type arg3, Arg4Type arg4, unsigned int n)
+    {
+        nova::detail::generate_dual_simd_loop(out0, out1,
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg1)),
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg2)),
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg3)),
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg4)),
+                                              n, Functor());
+    }
+
+    template <typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type, typename Arg4Type,
+              typename Arg5Type, typename Arg6Type>
+    static always_inline void perform_vec_simd(FloatType * out0, FloatType * out1, Arg1Type arg1, Arg2Type arg2,
+                                               Arg3Type arg3, Arg4Type arg4, Arg5Type arg5, Arg6Type arg6, unsigned int n)
+    {
+        nova::detail::generate_dual_simd_loop(out0, out1,
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg1)),
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg2)),
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg3)),
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg4)),
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg5)),
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg6)),
+                                              n, Functor());
+    }
+
+    template <unsigned int n, typename FloatType, typename Arg1Type, typename Arg2Type>
+    static always_inline void perform_vec_simd(FloatType * out0, FloatType * out1, Arg1Type arg1, Arg2Type arg2)
+    {
+        perform_vec_simd_<n, FloatType>(out0, out1,
+                                        nova::detail::wrap_vector_arg(wrap_argument(arg1)),
+                                        nova::detail::wrap_vector_arg(wrap_argument(arg2)));
+    }
+
+    template <unsigned int n, typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type, typename Arg4Type>
+    static always_inline void perform_vec_simd(FloatType * out0, FloatType * out1, Arg1Type arg1, Arg2Type arg2,
+                                               Arg3Type arg3, Arg4Type arg4)
+    {
+        perform_vec_simd_<n, FloatType>(out0, out1,
+                                        nova::detail::wrap_vector_arg(wrap_argument(arg1)),
+                                        nova::detail::wrap_vector_arg(wrap_argument(arg2)),
+                                        nova::detail::wrap_vector_arg(wrap_argument(arg3)),
+                                        nova::detail::wrap_vector_arg(wrap_argument(arg4)));
+    }
+
+    template <unsigned int n, typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type, typename Arg4Type,
+              typename Arg5Type, typename Arg6Type>
+    static always_inline void perform_vec_simd(FloatType * out0, FloatType * out1, Arg1Type arg1, Arg2Type arg2,
+                                               Arg3Type arg3, Arg4Type arg4, Arg5Type arg5, Arg6Type arg6)
+    {
+        perform_vec_simd_<n, FloatType>(out0, out1,
+                                        nova::detail::wrap_vector_arg(wrap_argument(arg1)),
+                                        nova::detail::wrap_vector_arg(wrap_argument(arg2)),
+                                        nova::detail::wrap_vector_arg(wrap_argument(arg3)),
+                                        nova::detail::wrap_vector_arg(wrap_argument(arg4)),
+                                        nova::detail::wrap_vector_arg(wrap_argument(arg5)),
+                                        nova::detail::wrap_vector_arg(wrap_argument(arg6)));
+    }
+
+private:
+    template <unsigned int n, typename FloatType, typename Arg1Type, typename Arg2Type>
+    static always_inline void perform_vec_simd_(FloatType * out0, FloatType * out1, Arg1Type arg1, Arg2Type arg2)
+    {
+        nova::detail::compile_time_dual_unroller<FloatType, n>::run(out0, out1, arg1, arg2, Functor());
+    }
+
+    template <unsigned int n, typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type, typename Arg4Type>
+    static always_inline void perform_vec_simd_(FloatType * out0, FloatType * out1, Arg1Type arg1, Arg2Type arg2,
+                                                Arg3Type arg3, Arg4Type arg4)
+    {
+        nova::detail::compile_time_dual_unroller<FloatType, n>::run(out0, out1, arg1, arg2, arg3, arg4, Functor());
+    }
+
+    template <unsigned int n, typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type, typename Arg4Type,
+              typename Arg5Type, typename Arg6Type>
+    static always_inline void perform_vec_simd_(FloatType * out0, FloatType * out1, Arg1Type arg1, Arg2Type arg2,
+                                                Arg3Type arg3, Arg4Type arg4, Arg5Type arg5, Arg6Type arg6)
+    {
+        nova::detail::compile_time_dual_unroller<FloatType, n>::run(out0, out1, arg1, arg2, arg3, arg4,
+                                                                    arg5, arg6, Functor());
+    }
+};
+
 } // namespace detail
 } // namespace nova
 
@@ -281,6 +402,112 @@ inline void NAME##_vec_simd(FloatType * out, Arg1 arg1, Arg2 arg2, Arg3 arg3, Ar
 }
 
 
+#define NOVA_SIMD_DEFINE_DUAL_OUTPUT_BINARY_WRAPPER(NAME, FUNCTOR)      \
+template <typename FloatType, typename Arg1, typename Arg2>             \
+inline void NAME##_vec(FloatType * out0, FloatType * out1, Arg1 arg1, Arg2 arg2, unsigned int n) \
+{                                                                       \
+    nova::detail::dual_output_functor<FUNCTOR>::perform_vec<FloatType>(out0, out1, arg1, arg2, n); \
+}                                                                       \
+                                                                        \
+template <typename FloatType, typename Arg1, typename Arg2>             \
+inline void NAME##_vec_simd(FloatType * out0, FloatType * out1, Arg1 arg1, Arg2 arg2, unsigned int n) \
+{                                                                       \
+    nova::detail::dual_output_functor<FUNCTOR>::perform_vec_simd<FloatType>(out0, out1, arg1, arg2, n); \
+}                                                                       \
+                                                                        \
+template <unsigned int n, typename FloatType, typename Arg1, typename Arg2> \
+inline void NAME##_vec_simd(FloatType * out0, FloatType * out1, Arg1 arg1, Arg2 arg2) \
+{                                                                       \
+    nova::detail::dual_output_functor<FUNCTOR>::perform_vec_simd<n, FloatType>(out0, out1, arg1, arg2); \
+}
+
+
+#define NOVA_SIMD_DEFINE_DUAL_OUTPUT_4ARY_WRAPPER(NAME, FUNCTOR)        \
+template <typename FloatType,                                           \
+          typename Arg1,                                                \
+          typename Arg2,                                                \
+          typename Arg3,                                                \
+          typename Arg4                                                 \
+         >                                                              \
+inline void NAME##_vec(FloatType * out0, FloatType * out1, Arg1 arg1, Arg2 arg2, \
+                       Arg3 arg3, Arg4 arg4, unsigned int n)            \
+{                                                                       \
+    nova::detail::dual_output_functor<FUNCTOR>::perform_vec<FloatType>(out0, out1, arg1, arg2, arg3, arg4, n); \
+}                                                                       \
+                                                                        \
+template <typename FloatType,                                           \
+          typename Arg1,                                                \
+          typename Arg2,                                                \
+          typename Arg3,                                                \
+          typename Arg4                                                 \
+         >                                                              \
+inline void NAME##_vec_simd(FloatType * out0, FloatType * out1, Arg1 arg1, Arg2 arg2, \
+                            Arg3 arg3, Arg4 arg4, unsigned int n)       \
+{                                                                       \
+    nova::detail::dual_output_functor<FUNCTOR>::perform_vec_simd<FloatType>(out0, out1, arg1, arg2, arg3, arg4, n); \
+}                                                                       \
+                                                                        \
+template <unsigned int n,                                               \
+          typename FloatType,                                           \
+          typename Arg1,                                                \
+          typename Arg2,                                                \
+          typename Arg3,                                                \
+          typename Arg4                                                 \
+         >                                                              \
+inline void NAME##_vec_simd(FloatType * out0, FloatType * out1, Arg1 arg1, Arg2 arg2, \
+                            Arg3 arg3, Arg4 arg4)                       \
+{                                                                       \
+    nova::detail::dual_output_functor<FUNCTOR>::perform_vec_simd<n, FloatType>(out0, out1, arg1, arg2, arg3, arg4); \
+}
+
+
+#define NOVA_SIMD_DEFINE_DUAL_OUTPUT_6ARY_WRAPPER(NAME, FUNCTOR)        \
+template <typename FloatType,                                           \
+          typename Arg1,                                                \
+          typename Arg2,                                                \
+          typename Arg3,                                                \
+          typename Arg4,                                                \
+          typename Arg5,                                                \
+          typename Arg6                                                 \
+         >                                                              \
+inline void NAME##_vec(FloatType * out0, FloatType * out1, Arg1 arg1, Arg2 arg2, \
+                       Arg3 arg3, Arg4 arg4, Arg5 arg5, Arg6 arg6, unsigned int n) \
+{                                                                       \
+    nova::detail::dual_output_functor<FUNCTOR>::perform_vec<FloatType>(out0, out1, arg1, arg2, arg3, arg4, \
+                                                                       arg5, arg6, n); \
+}                                                                       \
+                                                                        \
+template <typename FloatType,                                           \
+          typename Arg1,                                                \
+          typename Arg2,                                                \
+          typename Arg3,                                                \
+          typename Arg4,                                                \
+          typename Arg5,                                                \
+          typename Arg6                                                 \
+         >                                                              \
+inline void NAME##_vec_simd(FloatType * out0, FloatType * out1, Arg1 arg1, Arg2 arg2, \
+                            Arg3 arg3, Arg4 arg4, Arg5 arg5, Arg6 arg6, unsigned int n) \
+{                                                                       \
+    nova::detail::dual_output_functor<FUNCTOR>::perform_vec_simd<FloatType>(out0, out1, arg1, arg2, arg3, arg4, \
+                                                                            arg5, arg6, n); \
+}                                                                       \
+                                                                        \
+template <unsigned int n,                                               \
+          typename FloatType,                                           \
+          typename Arg1,                                                \
+          typename Arg2,                                                \
+          typename Arg3,                                                \
+          typename Arg4,                                                \
+          typename Arg5,                                                \
+          typename Arg6                                                 \
+         >                                                              \
+inline void NAME##_vec_simd(FloatType * out0, FloatType * out1, Arg1 arg1, Arg2 arg2, \
+                            Arg3 arg3, Arg4 arg4, Arg5 arg5, Arg6 arg6) \
+{                                                                       \
+    nova::detail::dual_output_functor<FUNCTOR>::perform_vec_simd<n, FloatType>(out0, out1, arg1, arg2, arg3, arg4, \
+                                                                               arg5, arg6); \
+}
+
 #undef always_inline
 
 #endif /* NOVA_SIMD_DETAIL_DEFINE_MACROS_HPP */
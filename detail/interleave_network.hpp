@@ -0,0 +1,87 @@
+//  transposition network for interleaved frames
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef NOVA_SIMD_DETAIL_INTERLEAVE_NETWORK_HPP
+#define NOVA_SIMD_DETAIL_INTERLEAVE_NETWORK_HPP
+
+#include "../vec.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+namespace nova {
+namespace detail {
+
+/* transpose Channels vectors of planar samples to Channels vectors of interleaved frames and back.
+ *
+ * the interleaved frames of all channels are the pairwise interleaved frames of the even and of the
+ * odd channels, so the network interleaves both halves recursively and combines them with the
+ * interleave/deinterleave shuffles of the backend. stride is the distance between the planar
+ * vectors of two neighboring channels.
+ */
+template <int Channels>
+struct interleave_network
+{
+    template <typename VecType>
+    static always_inline void interleave_vectors(VecType * out, const VecType * in, int stride)
+    {
+        VecType even[Channels/2], odd[Channels/2];
+        interleave_network<Channels/2>::interleave_vectors(even, in, 2 * stride);
+        interleave_network<Channels/2>::interleave_vectors(odd, in + stride, 2 * stride);
+
+        for (int i = 0; i != Channels/2; ++i)
+            interleave(even[i], odd[i], out[2*i], out[2*i+1]);
+    }
+
+    template <typename VecType>
+    static always_inline void deinterleave_vectors(VecType * out, const VecType * in, int stride)
+    {
+        VecType even[Channels/2], odd[Channels/2];
+        for (int i = 0; i != Channels/2; ++i)
+            deinterleave(in[2*i], in[2*i+1], even[i], odd[i]);
+
+        interleave_network<Channels/2>::deinterleave_vectors(out, even, 2 * stride);
+        interleave_network<Channels/2>::deinterleave_vectors(out + stride, odd, 2 * stride);
+    }
+};
+
+template <>
+struct interleave_network<1>
+{
+    template <typename VecType>
+    static always_inline void interleave_vectors(VecType * out, const VecType * in, int)
+    {
+        out[0] = in[0];
+    }
+
+    template <typename VecType>
+    static always_inline void deinterleave_vectors(VecType * out, const VecType * in, int)
+    {
+        out[0] = in[0];
+    }
+};
+
+} /* namespace detail */
+} /* namespace nova */
+
+#undef always_inline
+
+#endif /* NOVA_SIMD_DETAIL_INTERLEAVE_NETWORK_HPP */
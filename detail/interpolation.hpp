@@ -0,0 +1,97 @@
+//  interpolation kernels
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef NOVA_SIMD_DETAIL_INTERPOLATION_HPP
+#define NOVA_SIMD_DETAIL_INTERPOLATION_HPP
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+namespace nova {
+
+enum interpolation_type
+{
+    linear_interpolation,
+    hermite_interpolation,      /* 4-point, 3rd-order (catmull-rom) */
+    lagrange_interpolation      /* 4-point, 3rd-order */
+};
+
+namespace detail {
+
+/* the interpolators are evaluated between y0 and y1 at the fractional position t in [0, 1). ym1 and y2
+ * are the outer neighbors of y0 and y1. `points' is the number of samples that are actually used, so
+ * callers can avoid fetching ym1 and y2 for linear interpolation.
+ */
+
+template <typename F>
+struct linear_interpolator
+{
+    static const int points = 2;
+
+    template <typename T>
+    always_inline T operator()(T const &, T const & y0, T const & y1, T const &, T const & t) const
+    {
+        return y0 + t * (y1 - y0);
+    }
+};
+
+template <typename F>
+struct hermite_interpolator
+{
+    static const int points = 4;
+
+    template <typename T>
+    always_inline T operator()(T const & ym1, T const & y0, T const & y1, T const & y2, T const & t) const
+    {
+        T c1 = T(F(0.5)) * (y1 - ym1);
+        T c2 = ym1 - T(F(2.5)) * y0 + T(F(2)) * y1 - T(F(0.5)) * y2;
+        T c3 = T(F(0.5)) * (y2 - ym1) + T(F(1.5)) * (y0 - y1);
+
+        return ((c3 * t + c2) * t + c1) * t + y0;
+    }
+};
+
+template <typename F>
+struct lagrange_interpolator
+{
+    static const int points = 4;
+
+    template <typename T>
+    always_inline T operator()(T const & ym1, T const & y0, T const & y1, T const & y2, T const & t) const
+    {
+        T tp1 = t + T(F(1));
+        T tm1 = t - T(F(1));
+        T tm2 = t - T(F(2));
+
+        T a = tm1 * tm2;
+        T b = tp1 * t;
+
+        return T(F(1)/F(6)) * (y2 * b * tm1 - ym1 * t * a)
+            + T(F(0.5)) * (y0 * tp1 * a - y1 * b * tm2);
+    }
+};
+
+} /* namespace detail */
+} /* namespace nova */
+
+#undef always_inline
+
+#endif /* NOVA_SIMD_DETAIL_INTERPOLATION_HPP */
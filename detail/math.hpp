@@ -163,6 +163,73 @@ inline void apply_on_vector(FloatType * out, Arg1Type in1, Arg2Type in2, Arg3Typ
 
 ///@}
 
+///@{
+template <typename FloatType,
+          typename Arg1Type,
+          typename Arg2Type,
+          typename Functor
+         >
+inline void apply_on_vector_dual(FloatType * out0, FloatType * out1, Arg1Type in1, Arg2Type in2,
+                                 unsigned int n, Functor f)
+{
+    do
+    {
+        f(*out0++, *out1++, in1.get(), in2.get());
+        in1.increment();
+        in2.increment();
+    }
+    while (--n);
+}
+
+template <typename FloatType,
+          typename Arg1Type,
+          typename Arg2Type,
+          typename Arg3Type,
+          typename Arg4Type,
+          typename Functor
+         >
+inline void apply_on_vector_dual(FloatType * out0, FloatType * out1, Arg1Type in1, Arg2Type in2,
+                                 Arg3Type in3, Arg4Type in4, unsigned int n, Functor f)
+{
+    do
+    {
+        f(*out0++, *out1++, in1.get(), in2.get(), in3.get(), in4.get());
+        in1.increment();
+        in2.increment();
+        in3.increment();
+        in4.increment();
+    }
+    while (--n);
+}
+
+template <typename FloatType,
+          typename Arg1Type,
+          typename Arg2Type,
+          typename Arg3Type,
+          typename Arg4Type,
+          typename Arg5Type,
+          typename Arg6Type,
+          typename Functor
+         >
+inline void apply_on_vector_dual(FloatType * out0, FloatType * out1, Arg1Type in1, Arg2Type in2,
+                                 Arg3Type in3, Arg4Type in4, Arg5Type in5, Arg6Type in6,
+                                 unsigned int n, Functor f)
+{
+    do
+    {
+        f(*out0++, *out1++, in1.get(), in2.get(), in3.get(), in4.get(), in5.get(), in6.get());
+        in1.increment();
+        in2.increment();
+        in3.increment();
+        in4.increment();
+        in5.increment();
+        in6.increment();
+    }
+    while (--n);
+}
+
+///@}
+
 
 #define DEFINE_STD_UNARY_WRAPPER(NAME)          \
 template<typename float_type>                   \
@@ -174,6 +241,7 @@ inline float_type NAME(float_type const & x)    \
 DEFINE_STD_UNARY_WRAPPER(fabs)
 DEFINE_STD_UNARY_WRAPPER(floor)
 DEFINE_STD_UNARY_WRAPPER(ceil)
+DEFINE_STD_UNARY_WRAPPER(sqrt)
 
 DEFINE_STD_UNARY_WRAPPER(sin)
 DEFINE_STD_UNARY_WRAPPER(cos)
@@ -220,6 +220,94 @@ private:
 };
 
 
+/* unroller for functors with two outputs. the functor is called as f(out0, out1, args...) and
+ * stores its results in the first two arguments */
+template <typename FloatType,
+          int N
+         >
+struct compile_time_dual_unroller
+{
+    typedef vec<FloatType> vec_type;
+
+    static const int offset = vec_type::size;
+
+    template <typename arg1_type,
+              typename arg2_type,
+              typename Functor
+             >
+    static always_inline void run(FloatType * out0, FloatType * out1, arg1_type & in1, arg2_type & in2,
+                                  Functor const & f)
+    {
+        vec_type result0, result1;
+        f(result0, result1, in1.consume(), in2.consume());
+        result0.store_aligned(out0);
+        result1.store_aligned(out1);
+        compile_time_dual_unroller<FloatType, N-offset>::run(out0+offset, out1+offset, in1, in2, f);
+    }
+
+    template <typename arg1_type,
+              typename arg2_type,
+              typename arg3_type,
+              typename arg4_type,
+              typename Functor
+             >
+    static always_inline void run(FloatType * out0, FloatType * out1, arg1_type & in1, arg2_type & in2,
+                                  arg3_type & in3, arg4_type & in4, Functor const & f)
+    {
+        vec_type result0, result1;
+        f(result0, result1, in1.consume(), in2.consume(), in3.consume(), in4.consume());
+        result0.store_aligned(out0);
+        result1.store_aligned(out1);
+        compile_time_dual_unroller<FloatType, N-offset>::run(out0+offset, out1+offset, in1, in2, in3, in4, f);
+    }
+
+    template <typename arg1_type,
+              typename arg2_type,
+              typename arg3_type,
+              typename arg4_type,
+              typename arg5_type,
+              typename arg6_type,
+              typename Functor
+             >
+    static always_inline void run(FloatType * out0, FloatType * out1, arg1_type & in1, arg2_type & in2,
+                                  arg3_type & in3, arg4_type & in4, arg5_type & in5, arg6_type & in6,
+                                  Functor const & f)
+    {
+        vec_type result0, result1;
+        f(result0, result1, in1.consume(), in2.consume(), in3.consume(), in4.consume(),
+          in5.consume(), in6.consume());
+        result0.store_aligned(out0);
+        result1.store_aligned(out1);
+        compile_time_dual_unroller<FloatType, N-offset>::run(out0+offset, out1+offset, in1, in2, in3, in4,
+                                                             in5, in6, f);
+    }
+};
+
+template <typename FloatType>
+struct compile_time_dual_unroller<FloatType, 0>
+{
+    template <typename Arg1, typename Arg2,
+              typename Functor
+             >
+    static always_inline void run(FloatType *, FloatType *, Arg1 const &, Arg2 const &, Functor const &)
+    {}
+
+    template <typename Arg1, typename Arg2, typename Arg3, typename Arg4,
+              typename Functor
+             >
+    static always_inline void run(FloatType *, FloatType *, Arg1 const &, Arg2 const &,
+                                  Arg3 const &, Arg4 const &, Functor const &)
+    {}
+
+    template <typename Arg1, typename Arg2, typename Arg3, typename Arg4, typename Arg5, typename Arg6,
+              typename Functor
+             >
+    static always_inline void run(FloatType *, FloatType *, Arg1 const &, Arg2 const &,
+                                  Arg3 const &, Arg4 const &, Arg5 const &, Arg6 const &, Functor const &)
+    {}
+};
+
+
 template <typename float_type,
           typename Arg1,
           typename Functor
@@ -282,6 +370,66 @@ always_inline void generate_simd_loop(float_type * out, Arg1 arg1, Arg2 arg2, Ar
     } while (--n);
 }
 
+
+template <typename float_type,
+          typename Arg1,
+          typename Arg2,
+          typename Functor
+         >
+always_inline void generate_dual_simd_loop(float_type * out0, float_type * out1, Arg1 arg1, Arg2 arg2,
+                                           unsigned int n, Functor const & f)
+{
+    const unsigned int per_loop = vec<float_type>::objects_per_cacheline;
+    n /= per_loop;
+    do {
+        detail::compile_time_dual_unroller<float_type, per_loop>::run(out0, out1, arg1, arg2, f);
+        out0 += per_loop;
+        out1 += per_loop;
+    } while (--n);
+}
+
+template <typename float_type,
+          typename Arg1,
+          typename Arg2,
+          typename Arg3,
+          typename Arg4,
+          typename Functor
+         >
+always_inline void generate_dual_simd_loop(float_type * out0, float_type * out1, Arg1 arg1, Arg2 arg2,
+                                           Arg3 arg3, Arg4 arg4, unsigned int n, Functor const & f)
+{
+    const unsigned int per_loop = vec<float_type>::objects_per_cacheline;
+    n /= per_loop;
+    do {
+        detail::compile_time_dual_unroller<float_type, per_loop>::run(out0, out1, arg1, arg2, arg3, arg4, f);
+        out0 += per_loop;
+        out1 += per_loop;
+    } while (--n);
+}
+
+template <typename float_type,
+          typename Arg1,
+          typename Arg2,
+          typename Arg3,
+          typename Arg4,
+          typename Arg5,
+          typename Arg6,
+          typename Functor
+         >
+always_inline void generate_dual_simd_loop(float_type * out0, float_type * out1, Arg1 arg1, Arg2 arg2,
+                                           Arg3 arg3, Arg4 arg4, Arg5 arg5, Arg6 arg6,
+                                           unsigned int n, Functor const & f)
+{
+    const unsigned int per_loop = vec<float_type>::objects_per_cacheline;
+    n /= per_loop;
+    do {
+        detail::compile_time_dual_unroller<float_type, per_loop>::run(out0, out1, arg1, arg2, arg3, arg4,
+                                                                      arg5, arg6, f);
+        out0 += per_loop;
+        out1 += per_loop;
+    } while (--n);
+}
+
 }
 }
 
@@ -61,7 +61,8 @@ always_inline VecType vec_round_float(VecType const & arg)
     const vec two_to_23_ps (0x1.0p23f);
     const vec rounded = (abs_arg + two_to_23_ps) - two_to_23_ps;
 
-    return sign ^ rounded;
+    /* numbers >= 2^23 are integral, the addition would round them */
+    return sign ^ select(rounded, abs_arg, mask_ge(abs_arg, two_to_23_ps));
 }
 
 template <typename VecType>
@@ -479,6 +480,63 @@ always_inline VecType vec_atan_float(VecType const & arg)
 }
 
 
+/* reconstruct atan2(y, x) from the angle of min(|x|, |y|) / max(|x|, |y|) in [0, pi/4] */
+template <typename VecType>
+always_inline VecType vec_atan2_quadrant(VecType const & angle, VecType const & y, VecType const & x,
+                                         VecType const & abs_y, VecType const & abs_x)
+{
+    const VecType zero = VecType::gen_zero();
+    const VecType one  = VecType::gen_one();
+    const VecType sign_mask = VecType::gen_sign_mask();
+    const VecType pi_2(1.57079632679489661923132169163975144209858469968754);
+    const VecType pi  (3.14159265358979323846264338327950288419716939937510);
+
+    /* the quadrant is selected on the sign bits, so -0 behaves like std::atan2:
+     * atan2(+0, -0) = pi, atan2(-0, -x) = -pi */
+    const VecType sign_x = one | (x & sign_mask);
+
+    VecType ret = select(angle, pi_2 - angle, mask_gt(abs_y, abs_x));
+    ret = select(ret, pi - ret, mask_lt(sign_x, zero));
+    return ret ^ (y & sign_mask);
+}
+
+template <typename VecType>
+always_inline VecType vec_atan2_ratio(VecType const & abs_y, VecType const & abs_x)
+{
+    const VecType zero = VecType::gen_zero();
+    const VecType num = min_(abs_y, abs_x);
+    const VecType den = max_(abs_y, abs_x);
+    return select(num / den, zero, mask_eq(den, zero));
+}
+
+template <typename VecType>
+always_inline VecType vec_atan2(VecType const & y, VecType const & x)
+{
+    const VecType abs_y = abs(y);
+    const VecType abs_x = abs(x);
+
+    const VecType angle = atan(vec_atan2_ratio(abs_y, abs_x));
+    return vec_atan2_quadrant(angle, y, x, abs_y, abs_x);
+}
+
+/* approximation from abramowitz/stegun 4.4.49, absolute error below 1e-5 */
+template <typename VecType>
+always_inline VecType vec_fast_atan2(VecType const & y, VecType const & x)
+{
+    const VecType abs_y = abs(y);
+    const VecType abs_x = abs(x);
+
+    const VecType z  = vec_atan2_ratio(abs_y, abs_x);
+    const VecType z2 = z * z;
+
+    VecType poly = VecType(0.0208351) * z2 + VecType(-0.0851330);
+    poly = poly * z2 + VecType(0.1801410);
+    poly = poly * z2 + VecType(-0.3302995);
+    poly = poly * z2 + VecType(0.9998660);
+
+    return vec_atan2_quadrant(poly * z, y, x, abs_y, abs_x);
+}
+
 template <typename VecType>
 always_inline VecType vec_tanh_float(VecType const & arg)
 {
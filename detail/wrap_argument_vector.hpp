@@ -21,6 +21,7 @@
 
 #include "../vec.hpp"
 
+#include "interleave_network.hpp"
 #include "wrap_arguments.hpp"
 
 #if defined(__GNUC__) && defined(NDEBUG)
@@ -116,6 +117,163 @@ struct vector_ramp_argument
     vec<FloatType> slope_;
 };
 
+/* one channel of interleaved frames, the samples are gathered */
+template <typename FloatType>
+struct vector_strided_argument
+{
+    always_inline vector_strided_argument(const FloatType * frames, unsigned int channel, unsigned int stride):
+        data(frames), stride_(stride)
+    {
+        for (unsigned int i = 0; i != vec<FloatType>::size; ++i)
+            indices[i] = int(i * stride + channel);
+    }
+
+    always_inline void increment(void)
+    {
+        data += stride_ * vec<FloatType>::size;
+    }
+
+    always_inline vec<FloatType> get(void) const
+    {
+        vec<FloatType> ret;
+        ret.gather(data, indices);
+        return ret;
+    }
+
+    always_inline vec<FloatType> consume(void)
+    {
+        vec<FloatType> ret = get();
+        increment();
+        return ret;
+    }
+
+    const FloatType * data;
+    const unsigned int stride_;
+    int indices[vec<FloatType>::size];      /* channel + i * stride */
+};
+
+/* one channel of interleaved frames with a compile-time number of channels: mono and stereo frames
+ * are loaded and transposed with the interleave network. for more channels, gathering the samples of
+ * one channel is cheaper than transposing all of them */
+template <typename FloatType, unsigned int Channels>
+struct vector_interleaved_argument
+{
+    static const bool transpose = Channels <= 2;
+
+    always_inline vector_interleaved_argument(const FloatType * frames, unsigned int channel):
+        data(frames), channel_(channel)
+    {
+        for (unsigned int i = 0; i != vec<FloatType>::size; ++i)
+            indices[i] = int(i * Channels + channel);
+    }
+
+    always_inline void increment(void)
+    {
+        data += Channels * vec<FloatType>::size;
+    }
+
+    always_inline vec<FloatType> get(void) const
+    {
+        vec<FloatType> ret;
+        if (transpose) {
+            vec<FloatType> frames[Channels], planar[Channels];
+            for (unsigned int j = 0; j != Channels; ++j)
+                frames[j].load(data + j * vec<FloatType>::size);
+
+            interleave_network<transpose ? Channels : 1>::deinterleave_vectors(planar, frames, 1);
+            ret = planar[channel_];
+        } else
+            ret.gather(data, indices);
+        return ret;
+    }
+
+    always_inline vec<FloatType> consume(void)
+    {
+        vec<FloatType> ret = get();
+        increment();
+        return ret;
+    }
+
+    const FloatType * data;
+    const unsigned int channel_;
+    int indices[vec<FloatType>::size];      /* channel + i * Channels */
+};
+
+template <typename FloatType>
+struct vector_exp_ramp_argument
+{
+    always_inline vector_exp_ramp_argument(FloatType const & base, FloatType const & factor)
+    {
+        FloatType value = base;
+        FloatType factor_power = 1;
+        for (unsigned int i = 0; i != vec<FloatType>::size; ++i) {
+            data.set(i, value);
+            value *= factor;
+            factor_power *= factor;
+        }
+        factor_ = vec<FloatType>(factor_power);
+    }
+
+    always_inline void increment(void)
+    {
+        data *= factor_;
+    }
+
+    always_inline vec<FloatType> get(void) const
+    {
+        return data;
+    }
+
+    always_inline vec<FloatType> consume(void)
+    {
+        vec<FloatType> ret(data);
+        increment();
+        return ret;
+    }
+
+    vec<FloatType> data;
+    vec<FloatType> factor_;
+};
+
+template <typename FloatType>
+struct vector_smoothed_argument
+{
+    always_inline vector_smoothed_argument(FloatType const & target, FloatType const & decay,
+                                           FloatType const & distance):
+        target_(target)
+    {
+        FloatType value = distance;
+        FloatType decay_power = 1;
+        for (unsigned int i = 0; i != vec<FloatType>::size; ++i) {
+            distance_.set(i, value);
+            value *= decay;
+            decay_power *= decay;
+        }
+        decay_ = vec<FloatType>(decay_power);
+    }
+
+    always_inline void increment(void)
+    {
+        distance_ *= decay_;
+    }
+
+    always_inline vec<FloatType> get(void) const
+    {
+        return target_ + distance_;
+    }
+
+    always_inline vec<FloatType> consume(void)
+    {
+        vec<FloatType> ret = get();
+        increment();
+        return ret;
+    }
+
+    vec<FloatType> target_;
+    vec<FloatType> decay_;
+    vec<FloatType> distance_;
+};
+
 /* convert scalar args to vector args */
 template <typename FloatType>
 always_inline detail::vector_scalar_argument<FloatType>
@@ -138,6 +296,34 @@ wrap_vector_arg(detail::scalar_ramp_argument<FloatType> const & arg)
     return detail::vector_ramp_argument<FloatType>(arg.data, arg.slope_);
 }
 
+template <typename FloatType>
+always_inline detail::vector_strided_argument<FloatType>
+wrap_vector_arg(detail::scalar_strided_argument<FloatType> const & arg)
+{
+    return detail::vector_strided_argument<FloatType>(arg.data, arg.channel_, arg.stride_);
+}
+
+template <typename FloatType, unsigned int Channels>
+always_inline detail::vector_interleaved_argument<FloatType, Channels>
+wrap_vector_arg(detail::scalar_interleaved_argument<FloatType, Channels> const & arg)
+{
+    return detail::vector_interleaved_argument<FloatType, Channels>(arg.data, arg.channel_);
+}
+
+template <typename FloatType>
+always_inline detail::vector_exp_ramp_argument<FloatType>
+wrap_vector_arg(detail::scalar_exp_ramp_argument<FloatType> const & arg)
+{
+    return detail::vector_exp_ramp_argument<FloatType>(arg.data, arg.factor_);
+}
+
+template <typename FloatType>
+always_inline detail::vector_smoothed_argument<FloatType>
+wrap_vector_arg(detail::scalar_smoothed_argument<FloatType> const & arg)
+{
+    return detail::vector_smoothed_argument<FloatType>(arg.target_, arg.decay_, arg.distance);
+}
+
 } /* namespace detail */
 } /* namespace nova */
 
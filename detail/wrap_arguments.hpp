@@ -19,6 +19,8 @@
 #ifndef NOVA_SIMD_WRAP_ARGUMENTS_HPP
 #define NOVA_SIMD_WRAP_ARGUMENTS_HPP
 
+#include <cmath>
+
 #if defined(__GNUC__) && defined(NDEBUG)
 #define always_inline inline  __attribute__((always_inline))
 #else
@@ -107,6 +109,127 @@ struct scalar_ramp_argument
     const FloatType slope_;
 };
 
+/* one channel of interleaved frames */
+template <typename FloatType>
+struct scalar_strided_argument
+{
+    always_inline scalar_strided_argument(const FloatType * frames, unsigned int channel, unsigned int stride):
+        data(frames), channel_(channel), stride_(stride)
+    {}
+
+    always_inline void increment(void)
+    {
+        data += stride_;
+    }
+
+    always_inline FloatType get(void) const
+    {
+        return data[channel_];
+    }
+
+    always_inline FloatType consume(void)
+    {
+        FloatType ret = get();
+        increment();
+        return ret;
+    }
+
+    const FloatType * data;
+    const unsigned int channel_;
+    const unsigned int stride_;
+};
+
+/* one channel of interleaved frames with a compile-time number of channels */
+template <typename FloatType, unsigned int Channels>
+struct scalar_interleaved_argument
+{
+    always_inline scalar_interleaved_argument(const FloatType * frames, unsigned int channel):
+        data(frames), channel_(channel)
+    {}
+
+    always_inline void increment(void)
+    {
+        data += Channels;
+    }
+
+    always_inline FloatType get(void) const
+    {
+        return data[channel_];
+    }
+
+    always_inline FloatType consume(void)
+    {
+        FloatType ret = get();
+        increment();
+        return ret;
+    }
+
+    const FloatType * data;
+    const unsigned int channel_;
+};
+
+/* exponential ramp: multiplied by factor after each sample */
+template <typename FloatType>
+struct scalar_exp_ramp_argument
+{
+    always_inline scalar_exp_ramp_argument(FloatType const & base, FloatType const & factor):
+        data(base), factor_(factor)
+    {}
+
+    always_inline void increment(void)
+    {
+        data *= factor_;
+    }
+
+    always_inline FloatType get(void) const
+    {
+        return data;
+    }
+
+    always_inline FloatType consume(void)
+    {
+        FloatType ret = data;
+        increment();
+        return ret;
+    }
+
+    FloatType data;
+    const FloatType factor_;
+};
+
+/* one-pole smoothing towards target: y[i] = y[i-1] + coefficient * (target - y[i-1]), starting from
+ * y[-1] = current. the distance to the target decays exponentially, so it is stored as an
+ * exponential ramp. */
+template <typename FloatType>
+struct scalar_smoothed_argument
+{
+    always_inline scalar_smoothed_argument(FloatType const & current, FloatType const & target,
+                                           FloatType const & coefficient):
+        target_(target), decay_(FloatType(1) - coefficient), distance((current - target) * decay_)
+    {}
+
+    always_inline void increment(void)
+    {
+        distance *= decay_;
+    }
+
+    always_inline FloatType get(void) const
+    {
+        return target_ + distance;
+    }
+
+    always_inline FloatType consume(void)
+    {
+        FloatType ret = get();
+        increment();
+        return ret;
+    }
+
+    const FloatType target_;
+    const FloatType decay_;
+    FloatType distance;
+};
+
 }
 
 always_inline detail::scalar_scalar_argument<float> wrap_argument(float arg)
@@ -156,6 +279,34 @@ wrap_argument(detail::scalar_ramp_argument<FloatType> const & f)
     return f;
 }
 
+template <typename FloatType>
+always_inline detail::scalar_strided_argument<FloatType>
+wrap_argument(detail::scalar_strided_argument<FloatType> const & f)
+{
+    return f;
+}
+
+template <typename FloatType, unsigned int Channels>
+always_inline detail::scalar_interleaved_argument<FloatType, Channels>
+wrap_argument(detail::scalar_interleaved_argument<FloatType, Channels> const & f)
+{
+    return f;
+}
+
+template <typename FloatType>
+always_inline detail::scalar_exp_ramp_argument<FloatType>
+wrap_argument(detail::scalar_exp_ramp_argument<FloatType> const & f)
+{
+    return f;
+}
+
+template <typename FloatType>
+always_inline detail::scalar_smoothed_argument<FloatType>
+wrap_argument(detail::scalar_smoothed_argument<FloatType> const & f)
+{
+    return f;
+}
+
 template <typename FloatType>
 always_inline detail::scalar_scalar_argument<FloatType>
 scalar_argument(FloatType const & f)
@@ -177,6 +328,47 @@ slope_argument(FloatType const & value, FloatType const & slope)
     return wrap_argument(value, slope);
 }
 
+/** channel of interleaved frames with channels samples each, i.e. frames[i * channels + channel] */
+template <typename FloatType>
+always_inline detail::scalar_strided_argument<FloatType>
+interleaved_argument(const FloatType * frames, unsigned int channel, unsigned int channels)
+{
+    return detail::scalar_strided_argument<FloatType>(frames, channel, channels);
+}
+
+/** interleaved_argument with a compile-time number of channels, so the simd functions address the
+ *  frames without runtime dispatch */
+template <unsigned int Channels, typename FloatType>
+always_inline detail::scalar_interleaved_argument<FloatType, Channels>
+interleaved_argument(const FloatType * frames, unsigned int channel)
+{
+    return detail::scalar_interleaved_argument<FloatType, Channels>(frames, channel);
+}
+
+/** value * factor^i */
+template <typename FloatType>
+always_inline detail::scalar_exp_ramp_argument<FloatType>
+exp_ramp_argument(FloatType const & value, FloatType const & factor)
+{
+    return detail::scalar_exp_ramp_argument<FloatType>(value, factor);
+}
+
+/** one-pole smoothing from current towards target */
+template <typename FloatType>
+always_inline detail::scalar_smoothed_argument<FloatType>
+smoothed_argument(FloatType const & current, FloatType const & target, FloatType const & coefficient)
+{
+    return detail::scalar_smoothed_argument<FloatType>(current, target, coefficient);
+}
+
+/** value of a smoothed_argument after n samples, i.e. the current value for the next block */
+template <typename FloatType>
+inline FloatType smoothed_value(FloatType const & current, FloatType const & target, FloatType const & coefficient,
+                                unsigned int n)
+{
+    return target + (current - target) * FloatType(std::pow(double(FloatType(1) - coefficient), double(n)));
+}
+
 }
 
 #undef always_inline
@@ -0,0 +1,579 @@
+//  simd higher order ambisonics
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef SIMD_AMBISONICS_HPP
+#define SIMD_AMBISONICS_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+#include "vec.hpp"
+#include "detail/aligned_buffer.hpp"
+#include "detail/math.hpp"
+#include "detail/wrap_arguments.hpp"
+#include "detail/wrap_argument_vector.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+/* conventions: ACN channel order, SN3D normalization, no Condon-Shortley phase (AmbiX). directions
+ * are given in radians, azimuth 0 is the front (x), pi/2 the left (y), elevation pi/2 the top (z).
+ */
+
+namespace nova {
+
+static const unsigned int hoa_max_order = 5;
+
+inline unsigned int hoa_channels(unsigned int order)
+{
+    return (order + 1) * (order + 1);
+}
+
+namespace detail {
+
+/* real spherical harmonics, evaluated from the cartesian coordinates of a direction.
+ *
+ * with c = cos(elevation), Y_l^m = N_l^m P_l^|m|(z) cos(m azimuth) (sin for m < 0), where
+ * P_l^m(z) = (2m-1)!! c^m Q_l^m(z). c^m cos(m azimuth) and c^m sin(m azimuth) are the real and
+ * imaginary part of (x + iy)^m and Q_l^m is a polynomial, so no trigonometric functions are needed.
+ */
+template <typename F>
+class spherical_harmonics
+{
+public:
+    explicit spherical_harmonics(unsigned int order):
+        order_(order)
+    {
+        assert(order <= hoa_max_order);
+        for (unsigned int m = 0; m <= order; ++m) {
+            double double_factorial = 1;
+            for (unsigned int k = 1; k < 2 * m; k += 2)
+                double_factorial *= k;
+
+            for (unsigned int l = m; l <= order; ++l) {
+                double ratio = 1;               /* (l-m)! / (l+m)! */
+                for (unsigned int k = l - m + 1; k <= l + m; ++k)
+                    ratio /= k;
+
+                normalization[l][m] = F(std::sqrt((m == 0 ? 1.0 : 2.0) * ratio) * double_factorial);
+                if (l >= m + 2) {
+                    recursion_a[l][m] = F(double(2 * l - 1) / double(l - m));
+                    recursion_b[l][m] = F(double(l + m - 1) / double(l - m));
+                }
+            }
+        }
+    }
+
+    unsigned int order(void) const
+    {
+        return order_;
+    }
+
+    template <typename FloatType>
+    always_inline void operator()(FloatType x, FloatType y, FloatType z, FloatType * out) const
+    {
+        FloatType cos_m = FloatType(F(1));
+        FloatType sin_m = FloatType(F(0));
+
+        for (unsigned int m = 0; m <= order_; ++m) {
+            if (m) {
+                const FloatType next_cos = cos_m * x - sin_m * y;
+                sin_m = sin_m * x + cos_m * y;
+                cos_m = next_cos;
+            }
+
+            FloatType q_2 = FloatType(F(0));
+            FloatType q_1 = FloatType(F(1));
+            for (unsigned int l = m; l <= order_; ++l) {
+                FloatType q;
+                if (l == m)
+                    q = q_1;
+                else if (l == m + 1)
+                    q = FloatType(F(2 * m + 1)) * z;
+                else
+                    q = FloatType(recursion_a[l][m]) * z * q_1 - FloatType(recursion_b[l][m]) * q_2;
+
+                const FloatType weighted = FloatType(normalization[l][m]) * q;
+                out[l * l + l + m] = weighted * cos_m;
+                if (m)
+                    out[l * l + l - m] = weighted * sin_m;
+
+                if (l != m) {
+                    q_2 = q_1;
+                    q_1 = q;
+                }
+            }
+        }
+    }
+
+private:
+    const unsigned int order_;
+    F normalization[hoa_max_order + 1][hoa_max_order + 1];
+    F recursion_a[hoa_max_order + 1][hoa_max_order + 1];
+    F recursion_b[hoa_max_order + 1][hoa_max_order + 1];
+};
+
+/* rows x cols matrix, applied to blocks of planar buffers.
+ *
+ * the coefficients are stored broadcasted to vectors. for each vector of samples, the inputs of all
+ * columns are loaded once and four rows are accumulated at a time, so out may alias in. */
+template <typename F>
+class hoa_matrix
+{
+    typedef vec<F> vec_type;
+    static const unsigned int vec_size = vec_type::size;
+    static const unsigned int max_columns = (hoa_max_order + 1) * (hoa_max_order + 1);
+
+public:
+    hoa_matrix(unsigned int rows, unsigned int cols):
+        rows_(rows), cols_(cols), coefficients(rows * cols), vector_coefficients(rows * cols * vec_size)
+    {
+        assert(cols <= max_columns);
+    }
+
+    unsigned int rows(void) const
+    {
+        return rows_;
+    }
+
+    unsigned int cols(void) const
+    {
+        return cols_;
+    }
+
+    F get(unsigned int row, unsigned int col) const
+    {
+        return coefficients[row * cols_ + col];
+    }
+
+    void set(unsigned int row, unsigned int col, F value)
+    {
+        coefficients[row * cols_ + col] = value;
+        for (unsigned int lane = 0; lane != vec_size; ++lane)
+            vector_coefficients[(row * cols_ + col) * vec_size + lane] = value;
+    }
+
+    void apply(F * const * out, const F * const * in, unsigned int n) const
+    {
+        for (unsigned int i = 0; i != n; ++i) {
+            F inputs[max_columns];
+            for (unsigned int col = 0; col != cols_; ++col)
+                inputs[col] = in[col][i];
+
+            for (unsigned int row = 0; row != rows_; ++row) {
+                const F * c = coefficients.data() + row * cols_;
+                F sum = 0;
+                for (unsigned int col = 0; col != cols_; ++col)
+                    sum += c[col] * inputs[col];
+                out[row][i] = sum;
+            }
+        }
+    }
+
+    void apply_simd(F * const * out, const F * const * in, unsigned int n) const
+    {
+        for (unsigned int i = 0; i != n; i += vec_size) {
+            vec_type inputs[max_columns];
+            for (unsigned int col = 0; col != cols_; ++col)
+                inputs[col].load_aligned(in[col] + i);
+
+            unsigned int row = 0;
+            for (; row + 4 <= rows_; row += 4) {
+                const F * c0 = vector_coefficients.data() + row * cols_ * vec_size;
+                const F * c1 = c0 + cols_ * vec_size;
+                const F * c2 = c1 + cols_ * vec_size;
+                const F * c3 = c2 + cols_ * vec_size;
+
+                vec_type sum0, sum1, sum2, sum3;
+                sum0.clear();
+                sum1.clear();
+                sum2.clear();
+                sum3.clear();
+                for (unsigned int col = 0; col != cols_; ++col) {
+                    vec_type f0, f1, f2, f3;
+                    f0.load_aligned(c0 + col * vec_size);
+                    f1.load_aligned(c1 + col * vec_size);
+                    f2.load_aligned(c2 + col * vec_size);
+                    f3.load_aligned(c3 + col * vec_size);
+                    sum0 += f0 * inputs[col];
+                    sum1 += f1 * inputs[col];
+                    sum2 += f2 * inputs[col];
+                    sum3 += f3 * inputs[col];
+                }
+                sum0.store_aligned(out[row] + i);
+                sum1.store_aligned(out[row + 1] + i);
+                sum2.store_aligned(out[row + 2] + i);
+                sum3.store_aligned(out[row + 3] + i);
+            }
+
+            for (; row != rows_; ++row) {
+                const F * c = vector_coefficients.data() + row * cols_ * vec_size;
+                vec_type sum;
+                sum.clear();
+                for (unsigned int col = 0; col != cols_; ++col) {
+                    vec_type f;
+                    f.load_aligned(c + col * vec_size);
+                    sum += f * inputs[col];
+                }
+                sum.store_aligned(out[row] + i);
+            }
+        }
+    }
+
+private:
+    const unsigned int rows_, cols_;
+    aligned_buffer<F> coefficients;
+    aligned_buffer<F> vector_coefficients;
+};
+
+template <typename F>
+inline void direction_to_cartesian(F azimuth, F elevation, F * out)
+{
+    out[0] = std::cos(elevation) * std::cos(azimuth);
+    out[1] = std::cos(elevation) * std::sin(azimuth);
+    out[2] = std::sin(elevation);
+}
+
+/* solve a x = b for a symmetric positive definite n x n matrix and m right hand sides (row-major),
+ * the solution replaces b */
+inline void solve_linear_system(std::vector<double> & a, std::vector<double> & b, unsigned int n, unsigned int m)
+{
+    for (unsigned int column = 0; column != n; ++column) {
+        unsigned int pivot = column;
+        for (unsigned int row = column + 1; row != n; ++row)
+            if (std::abs(a[row * n + column]) > std::abs(a[pivot * n + column]))
+                pivot = row;
+
+        for (unsigned int k = 0; k != n; ++k)
+            std::swap(a[column * n + k], a[pivot * n + k]);
+        for (unsigned int k = 0; k != m; ++k)
+            std::swap(b[column * m + k], b[pivot * m + k]);
+
+        for (unsigned int row = 0; row != n; ++row) {
+            if (row == column)
+                continue;
+            const double factor = a[row * n + column] / a[column * n + column];
+            for (unsigned int k = column; k != n; ++k)
+                a[row * n + k] -= factor * a[column * n + k];
+            for (unsigned int k = 0; k != m; ++k)
+                b[row * m + k] -= factor * b[column * m + k];
+        }
+    }
+
+    for (unsigned int row = 0; row != n; ++row)
+        for (unsigned int k = 0; k != m; ++k)
+            b[row * m + k] /= a[row * n + row];
+}
+
+}
+
+/* ambisonic encoder
+ *
+ * encodes a mono signal with a per-sample direction to hoa_channels(order) buffers. azimuth and
+ * elevation can be scalars, buffers or slope arguments. encode_simd evaluates the spherical
+ * harmonics of vec<F>::size samples at once, it requires n to be a multiple of vec<F>::size and
+ * aligned buffers.
+ */
+template <typename F>
+class hoa_encoder
+{
+    typedef vec<F> vec_type;
+    static const unsigned int vec_size = vec_type::size;
+
+public:
+    explicit hoa_encoder(unsigned int order):
+        harmonics(order)
+    {}
+
+    unsigned int order(void) const
+    {
+        return harmonics.order();
+    }
+
+    unsigned int channels(void) const
+    {
+        return hoa_channels(harmonics.order());
+    }
+
+    template <typename AzimuthArg, typename ElevationArg>
+    void encode(F * const * out, const F * in, AzimuthArg azimuth, ElevationArg elevation, unsigned int n) const
+    {
+        encode_(out, in, wrap_argument(azimuth), wrap_argument(elevation), n);
+    }
+
+    template <typename AzimuthArg, typename ElevationArg>
+    void encode_simd(F * const * out, const F * in, AzimuthArg azimuth, ElevationArg elevation, unsigned int n) const
+    {
+        encode_simd_(out, in, detail::wrap_vector_arg(wrap_argument(azimuth)),
+                     detail::wrap_vector_arg(wrap_argument(elevation)), n);
+    }
+
+private:
+    template <typename AzimuthArg, typename ElevationArg>
+    void encode_(F * const * out, const F * in, AzimuthArg azimuth, ElevationArg elevation, unsigned int n) const
+    {
+        const unsigned int count = channels();
+        for (unsigned int i = 0; i != n; ++i) {
+            F direction[3];
+            detail::direction_to_cartesian(azimuth.consume(), elevation.consume(), direction);
+
+            F gains[hoa_max_order * hoa_max_order + 2 * hoa_max_order + 1];
+            harmonics(direction[0], direction[1], direction[2], gains);
+
+            const F sample = in[i];
+            for (unsigned int channel = 0; channel != count; ++channel)
+                out[channel][i] = sample * gains[channel];
+        }
+    }
+
+    template <typename AzimuthArg, typename ElevationArg>
+    void encode_simd_(F * const * out, const F * in, AzimuthArg azimuth, ElevationArg elevation, unsigned int n) const
+    {
+        const unsigned int count = channels();
+        for (unsigned int i = 0; i != n; i += vec_size) {
+            const vec_type az = azimuth.consume();
+            const vec_type el = elevation.consume();
+            const vec_type horizontal = cos(el);
+
+            vec_type gains[hoa_max_order * hoa_max_order + 2 * hoa_max_order + 1];
+            harmonics(horizontal * cos(az), horizontal * sin(az), sin(el), gains);
+
+            vec_type sample;
+            sample.load_aligned(in + i);
+            for (unsigned int channel = 0; channel != count; ++channel)
+                (sample * gains[channel]).store_aligned(out[channel] + i);
+        }
+    }
+
+    detail::spherical_harmonics<F> harmonics;
+};
+
+/* sound field rotation
+ *
+ * set_rotation computes the rotation matrix of each order for a rotation by roll (around x), pitch
+ * (around y) and yaw (around z), applied in this order: a source at direction p is moved to
+ * Rz(yaw) Ry(pitch) Rx(roll) p. the matrices are block diagonal, each order is rotated separately.
+ * the matrices are fitted to the spherical harmonics of rotated sample directions. out may alias in.
+ */
+template <typename F>
+class hoa_rotator
+{
+    hoa_rotator(hoa_rotator const &);
+    hoa_rotator & operator=(hoa_rotator const &);
+
+public:
+    explicit hoa_rotator(unsigned int order):
+        order_(order)
+    {
+        assert(order <= hoa_max_order);
+        std::fill(blocks, blocks + hoa_max_order + 1, (detail::hoa_matrix<F>*)0);
+
+        /* free the blocks that are already built, if a later allocation throws */
+        try {
+            for (unsigned int l = 0; l <= order; ++l)
+                blocks[l] = new detail::hoa_matrix<F>(2 * l + 1, 2 * l + 1);
+            set_rotation(0, 0, 0);
+        } catch (...) {
+            free_blocks();
+            throw;
+        }
+    }
+
+    ~hoa_rotator(void)
+    {
+        free_blocks();
+    }
+
+    unsigned int channels(void) const
+    {
+        return hoa_channels(order_);
+    }
+
+    /* coefficient of the rotation matrix */
+    F coefficient(unsigned int row, unsigned int col) const
+    {
+        const unsigned int l = (unsigned int)std::sqrt(double(row));
+        if (col < l * l || col >= (l + 1) * (l + 1))
+            return F(0);
+        return blocks[l]->get(row - l * l, col - l * l);
+    }
+
+    void set_rotation(double yaw, double pitch, double roll)
+    {
+        const double cy = std::cos(yaw), sy = std::sin(yaw);
+        const double cp = std::cos(pitch), sp = std::sin(pitch);
+        const double cr = std::cos(roll), sr = std::sin(roll);
+        const double rotation[3][3] = {
+            {cy * cp, cy * sp * sr - sy * cr, cy * sp * cr + sy * sr},
+            {sy * cp, sy * sp * sr + cy * cr, sy * sp * cr - cy * sr},
+            {-sp,     cp * sr,                cp * cr}
+        };
+
+        /* sample directions on a fibonacci spiral */
+        const unsigned int points = 64;
+        const unsigned int count = hoa_channels(order_);
+        const detail::spherical_harmonics<double> harmonics(order_);
+        std::vector<double> original(points * count), rotated(points * count);
+
+        for (unsigned int k = 0; k != points; ++k) {
+            const double z = 1.0 - (2.0 * k + 1.0) / points;
+            const double r = std::sqrt(1.0 - z * z);
+            const double phi = 2.399963229728653 * k;
+            const double p[3] = {r * std::cos(phi), r * std::sin(phi), z};
+
+            double q[3];
+            for (int i = 0; i != 3; ++i)
+                q[i] = rotation[i][0] * p[0] + rotation[i][1] * p[1] + rotation[i][2] * p[2];
+
+            harmonics(p[0], p[1], p[2], &original[k * count]);
+            harmonics(q[0], q[1], q[2], &rotated[k * count]);
+        }
+
+        /* Y(q) = R Y(p): least squares fit R^T = (P^T P)^-1 P^T Q for each order */
+        for (unsigned int l = 0; l <= order_; ++l) {
+            const unsigned int size = 2 * l + 1;
+            const unsigned int offset = l * l;
+            std::vector<double> normal(size * size), rhs(size * size);
+
+            for (unsigned int i = 0; i != size; ++i) {
+                for (unsigned int j = 0; j != size; ++j) {
+                    double pp = 0, pq = 0;
+                    for (unsigned int k = 0; k != points; ++k) {
+                        pp += original[k * count + offset + i] * original[k * count + offset + j];
+                        pq += original[k * count + offset + i] * rotated[k * count + offset + j];
+                    }
+                    normal[i * size + j] = pp;
+                    rhs[i * size + j] = pq;
+                }
+            }
+
+            detail::solve_linear_system(normal, rhs, size, size);
+
+            for (unsigned int i = 0; i != size; ++i)
+                for (unsigned int j = 0; j != size; ++j)
+                    blocks[l]->set(i, j, F(rhs[j * size + i]));
+        }
+    }
+
+    void process(F * const * out, const F * const * in, unsigned int n) const
+    {
+        for (unsigned int l = 0; l <= order_; ++l)
+            blocks[l]->apply(out + l * l, in + l * l, n);
+    }
+
+    /* n must be a multiple of vec<F>::size, buffers must be aligned */
+    void process_simd(F * const * out, const F * const * in, unsigned int n) const
+    {
+        for (unsigned int l = 0; l <= order_; ++l)
+            blocks[l]->apply_simd(out + l * l, in + l * l, n);
+    }
+
+private:
+    void free_blocks(void)
+    {
+        for (unsigned int l = 0; l <= order_; ++l)
+            delete blocks[l];
+    }
+
+    const unsigned int order_;
+    detail::hoa_matrix<F> * blocks[hoa_max_order + 1];
+};
+
+/* ambisonic decoder
+ *
+ * multiplies the hoa_channels(order) input buffers with a speakers x channels matrix. the default
+ * matrix is the sampling (projection) decoder of the speaker directions, the coefficients can be
+ * replaced with set_coefficient, e.g. for mode-matching or max-rE decoders.
+ */
+template <typename F>
+class hoa_decoder
+{
+    hoa_decoder(hoa_decoder const &);
+    hoa_decoder & operator=(hoa_decoder const &);
+
+public:
+    hoa_decoder(unsigned int order, const F * azimuth, const F * elevation, unsigned int speakers):
+        order_(order), matrix(speakers, hoa_channels(order))
+    {
+        const unsigned int count = hoa_channels(order);
+        const detail::spherical_harmonics<double> harmonics(order);
+        std::vector<double> gains(count);
+
+        for (unsigned int speaker = 0; speaker != speakers; ++speaker) {
+            double p[3];
+            detail::direction_to_cartesian<double>(azimuth[speaker], elevation[speaker], p);
+            harmonics(p[0], p[1], p[2], &gains[0]);
+
+            /* sn3d to n3d weights: (2l + 1) */
+            for (unsigned int l = 0; l <= order; ++l)
+                for (unsigned int channel = l * l; channel != (l + 1) * (l + 1); ++channel)
+                    matrix.set(speaker, channel, F(gains[channel] * (2 * l + 1) / speakers));
+        }
+    }
+
+    unsigned int order(void) const
+    {
+        return order_;
+    }
+
+    unsigned int speakers(void) const
+    {
+        return matrix.rows();
+    }
+
+    unsigned int channels(void) const
+    {
+        return matrix.cols();
+    }
+
+    F coefficient(unsigned int speaker, unsigned int channel) const
+    {
+        return matrix.get(speaker, channel);
+    }
+
+    void set_coefficient(unsigned int speaker, unsigned int channel, F value)
+    {
+        matrix.set(speaker, channel, value);
+    }
+
+    void process(F * const * out, const F * const * in, unsigned int n) const
+    {
+        matrix.apply(out, in, n);
+    }
+
+    /* n must be a multiple of vec<F>::size, buffers must be aligned */
+    void process_simd(F * const * out, const F * const * in, unsigned int n) const
+    {
+        matrix.apply_simd(out, in, n);
+    }
+
+private:
+    const unsigned int order_;
+    detail::hoa_matrix<F> matrix;
+};
+
+} /* namespace nova */
+
+#undef always_inline
+
+#endif /* SIMD_AMBISONICS_HPP */
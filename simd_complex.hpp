@@ -0,0 +1,171 @@
+//  simd functions for split-complex arithmetic
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef SIMD_COMPLEX_HPP
+#define SIMD_COMPLEX_HPP
+
+#include <cmath>
+
+#include "vec.hpp"
+#include "detail/define_macros.hpp"
+#include "detail/vec_math.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+/* complex numbers are passed as split (real, imaginary) argument pairs. each part can be a
+ * pointer, a scalar or a slope argument, so a spectrum can be combined with a constant
+ * complex factor without expanding it to a buffer.
+ *
+ * complex_mul_vec(out_re, out_im, a_re, a_im, b_re, b_im, n):      out = a * b
+ * complex_conj_mul_vec(out_re, out_im, a_re, a_im, b_re, b_im, n): out = a * conj(b)
+ * complex_madd_vec(out_re, out_im, a_re, a_im, b_re, b_im,
+ *                  c_re, c_im, n):                                 out = a * b + c
+ * complex_mag_squared_vec(out, re, im, n):                         out = re*re + im*im
+ *
+ * complex_madd can be used to accumulate in-place by passing out_re/out_im as c_re/c_im.
+ *
+ * conversion between cartesian and polar representation:
+ *
+ * car2pol_vec(out_mag, out_phase, re, im, n)
+ * car2pol_fast_vec(out_mag, out_phase, re, im, n):  phase with an absolute error below 1e-5
+ * pol2car_vec(out_re, out_im, mag, phase, n)
+ *
+ * the phase is in the range [-pi, pi].
+ */
+
+namespace nova {
+namespace detail {
+
+struct complex_mul
+{
+    template<typename ArgType>
+    always_inline void operator()(ArgType & out_re, ArgType & out_im,
+                                  ArgType a_re, ArgType a_im, ArgType b_re, ArgType b_im) const
+    {
+        out_re = a_re * b_re - a_im * b_im;
+        out_im = a_re * b_im + a_im * b_re;
+    }
+};
+
+struct complex_conj_mul
+{
+    template<typename ArgType>
+    always_inline void operator()(ArgType & out_re, ArgType & out_im,
+                                  ArgType a_re, ArgType a_im, ArgType b_re, ArgType b_im) const
+    {
+        out_re = a_re * b_re + a_im * b_im;
+        out_im = a_im * b_re - a_re * b_im;
+    }
+};
+
+struct complex_madd
+{
+    template<typename ArgType>
+    always_inline void operator()(ArgType & out_re, ArgType & out_im,
+                                  ArgType a_re, ArgType a_im, ArgType b_re, ArgType b_im,
+                                  ArgType c_re, ArgType c_im) const
+    {
+        out_re = c_re + (a_re * b_re - a_im * b_im);
+        out_im = c_im + (a_re * b_im + a_im * b_re);
+    }
+};
+
+struct complex_mag_squared
+{
+    template<typename ArgType>
+    always_inline ArgType operator()(ArgType re, ArgType im) const
+    {
+        return re * re + im * im;
+    }
+};
+
+struct car2pol
+{
+    template<typename FloatType>
+    always_inline void operator()(FloatType & mag, FloatType & phase, FloatType re, FloatType im) const
+    {
+        mag   = std::sqrt(re * re + im * im);
+        phase = std::atan2(im, re);
+    }
+
+    template<typename FloatType>
+    always_inline void operator()(vec<FloatType> & mag, vec<FloatType> & phase,
+                                  vec<FloatType> re, vec<FloatType> im) const
+    {
+        mag   = sqrt(re * re + im * im);
+        phase = vec_atan2(im, re);
+    }
+};
+
+struct car2pol_fast
+{
+    template<typename FloatType>
+    always_inline void operator()(FloatType & mag, FloatType & phase, FloatType re, FloatType im) const
+    {
+        mag   = std::sqrt(re * re + im * im);
+        phase = std::atan2(im, re);
+    }
+
+    template<typename FloatType>
+    always_inline void operator()(vec<FloatType> & mag, vec<FloatType> & phase,
+                                  vec<FloatType> re, vec<FloatType> im) const
+    {
+        mag   = sqrt(re * re + im * im);
+        phase = vec_fast_atan2(im, re);
+    }
+};
+
+struct pol2car
+{
+    template<typename FloatType>
+    always_inline void operator()(FloatType & re, FloatType & im, FloatType mag, FloatType phase) const
+    {
+        re = mag * std::cos(phase);
+        im = mag * std::sin(phase);
+    }
+
+    template<typename FloatType>
+    always_inline void operator()(vec<FloatType> & re, vec<FloatType> & im,
+                                  vec<FloatType> mag, vec<FloatType> phase) const
+    {
+        re = mag * cos(phase);
+        im = mag * sin(phase);
+    }
+};
+
+}
+
+NOVA_SIMD_DEFINE_DUAL_OUTPUT_4ARY_WRAPPER(complex_mul, detail::complex_mul)
+NOVA_SIMD_DEFINE_DUAL_OUTPUT_4ARY_WRAPPER(complex_conj_mul, detail::complex_conj_mul)
+NOVA_SIMD_DEFINE_DUAL_OUTPUT_6ARY_WRAPPER(complex_madd, detail::complex_madd)
+
+NOVA_SIMD_DEFINE_BINARY_WRAPPER(complex_mag_squared, detail::complex_mag_squared)
+
+NOVA_SIMD_DEFINE_DUAL_OUTPUT_BINARY_WRAPPER(car2pol, detail::car2pol)
+NOVA_SIMD_DEFINE_DUAL_OUTPUT_BINARY_WRAPPER(car2pol_fast, detail::car2pol_fast)
+NOVA_SIMD_DEFINE_DUAL_OUTPUT_BINARY_WRAPPER(pol2car, detail::pol2car)
+
+}
+
+#undef always_inline
+
+#endif /* SIMD_COMPLEX_HPP */
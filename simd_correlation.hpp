@@ -0,0 +1,220 @@
+//  simd dot product and correlation functions
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef SIMD_CORRELATION_HPP
+#define SIMD_CORRELATION_HPP
+
+#include <cassert>
+
+#include "vec.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+namespace nova {
+
+/* dot product */
+template <typename F>
+inline F dot_vec(const F * in0, const F * in1, unsigned int n)
+{
+    F sum = 0;
+    for (unsigned int i = 0; i != n; ++i)
+        sum += in0[i] * in1[i];
+    return sum;
+}
+
+/* four independent accumulators, n must be a multiple of vec<F>::size, buffers must be aligned */
+template <typename F>
+inline F dot_vec_simd(const F * in0, const F * in1, unsigned int n)
+{
+    typedef vec<F> vec_type;
+    const unsigned int vec_size = vec_type::size;
+    assert(n % vec_size == 0);
+
+    vec_type sum0, sum1, sum2, sum3;
+    sum0.clear();
+    sum1.clear();
+    sum2.clear();
+    sum3.clear();
+
+    unsigned int i = 0;
+    for (; i + 4 * vec_size <= n; i += 4 * vec_size) {
+        vec_type a0, a1, a2, a3, b0, b1, b2, b3;
+        a0.load_aligned(in0 + i);
+        a1.load_aligned(in0 + i + vec_size);
+        a2.load_aligned(in0 + i + 2 * vec_size);
+        a3.load_aligned(in0 + i + 3 * vec_size);
+        b0.load_aligned(in1 + i);
+        b1.load_aligned(in1 + i + vec_size);
+        b2.load_aligned(in1 + i + 2 * vec_size);
+        b3.load_aligned(in1 + i + 3 * vec_size);
+        sum0 += a0 * b0;
+        sum1 += a1 * b1;
+        sum2 += a2 * b2;
+        sum3 += a3 * b3;
+    }
+
+    for (; i != n; i += vec_size) {
+        vec_type a, b;
+        a.load_aligned(in0 + i);
+        b.load_aligned(in1 + i);
+        sum0 += a * b;
+    }
+
+    return ((sum0 + sum1) + (sum2 + sum3)).horizontal_sum();
+}
+
+namespace detail {
+
+/* sum of in0[i] * in1[i + lag] for four consecutive lags over the samples [begin, end), end - begin
+ * must be a multiple of vec<F>::size. in0 + begin must be aligned, in1 is loaded unaligned. the four
+ * lags are independent accumulators and share the loads of in0. */
+template <typename F>
+always_inline void correlate_four_lags(F * out, const F * in0, const F * in1, unsigned int begin, unsigned int end)
+{
+    typedef vec<F> vec_type;
+    const unsigned int vec_size = vec_type::size;
+
+    vec_type sum0, sum1, sum2, sum3;
+    sum0.clear();
+    sum1.clear();
+    sum2.clear();
+    sum3.clear();
+
+    for (unsigned int i = begin; i != end; i += vec_size) {
+        vec_type a, b0, b1, b2, b3;
+        a.load_aligned(in0 + i);
+        b0.load(in1 + i);
+        b1.load(in1 + i + 1);
+        b2.load(in1 + i + 2);
+        b3.load(in1 + i + 3);
+        sum0 += a * b0;
+        sum1 += a * b1;
+        sum2 += a * b2;
+        sum3 += a * b3;
+    }
+
+    out[0] = sum0.horizontal_sum();
+    out[1] = sum1.horizontal_sum();
+    out[2] = sum2.horizontal_sum();
+    out[3] = sum3.horizontal_sum();
+}
+
+template <typename F>
+always_inline F correlate_lag(const F * in0, const F * in1, unsigned int begin, unsigned int end)
+{
+    typedef vec<F> vec_type;
+    const unsigned int vec_size = vec_type::size;
+
+    vec_type sum0, sum1;
+    sum0.clear();
+    sum1.clear();
+
+    unsigned int i = begin;
+    for (; i + 2 * vec_size <= end; i += 2 * vec_size) {
+        vec_type a0, a1, b0, b1;
+        a0.load_aligned(in0 + i);
+        a1.load_aligned(in0 + i + vec_size);
+        b0.load(in1 + i);
+        b1.load(in1 + i + vec_size);
+        sum0 += a0 * b0;
+        sum1 += a1 * b1;
+    }
+
+    for (; i != end; i += vec_size) {
+        vec_type a, b;
+        a.load_aligned(in0 + i);
+        b.load(in1 + i);
+        sum0 += a * b;
+    }
+
+    return (sum0 + sum1).horizontal_sum();
+}
+
+}
+
+/* @{ */
+/** cross-correlation: out[lag] = sum_{i < n} in0[i] * in1[i + lag] for lag < lags.
+ *  in1 must hold n + lags - 1 samples */
+template <typename F>
+inline void cross_correlation_vec(F * out, const F * in0, const F * in1, unsigned int n, unsigned int lags)
+{
+    for (unsigned int lag = 0; lag != lags; ++lag)
+        out[lag] = dot_vec(in0, in1 + lag, n);
+}
+
+/* four lags are computed per pass over in0, n must be a multiple of vec<F>::size, in0 must be aligned */
+template <typename F>
+inline void cross_correlation_vec_simd(F * out, const F * in0, const F * in1, unsigned int n, unsigned int lags)
+{
+    assert(n % vec<F>::size == 0);
+
+    unsigned int lag = 0;
+    for (; lag + 4 <= lags; lag += 4)
+        detail::correlate_four_lags(out + lag, in0, in1 + lag, 0, n);
+
+    for (; lag != lags; ++lag)
+        out[lag] = detail::correlate_lag(in0, in1 + lag, 0, n);
+}
+/* @} */
+
+/* @{ */
+/** autocorrelation: out[lag] = sum_{i < n - lag} in[i] * in[i + lag] for lag < lags <= n */
+template <typename F>
+inline void autocorrelation_vec(F * out, const F * in, unsigned int n, unsigned int lags)
+{
+    assert(lags <= n);
+    for (unsigned int lag = 0; lag != lags; ++lag)
+        out[lag] = dot_vec(in, in + lag, n - lag);
+}
+
+/* the vectorized part of each lag covers the samples that all four lags of a pass have in common,
+ * the remaining samples of each lag are summed up in scalar code. in must be aligned */
+template <typename F>
+inline void autocorrelation_vec_simd(F * out, const F * in, unsigned int n, unsigned int lags)
+{
+    assert(lags <= n);
+    const unsigned int vec_size = vec<F>::size;
+
+    unsigned int lag = 0;
+    for (; lag + 4 <= lags; lag += 4) {
+        const unsigned int common = n - (lag + 3);
+        const unsigned int vectorized = common - common % vec_size;
+        detail::correlate_four_lags(out + lag, in, in + lag, 0, vectorized);
+
+        for (unsigned int k = 0; k != 4; ++k)
+            out[lag + k] += dot_vec(in + vectorized, in + vectorized + lag + k, n - lag - k - vectorized);
+    }
+
+    for (; lag != lags; ++lag) {
+        const unsigned int count = n - lag;
+        const unsigned int vectorized = count - count % vec_size;
+        out[lag] = detail::correlate_lag(in, in + lag, 0, vectorized)
+                   + dot_vec(in + vectorized, in + vectorized + lag, count - vectorized);
+    }
+}
+/* @} */
+
+} /* namespace nova */
+
+#undef always_inline
+
+#endif /* SIMD_CORRELATION_HPP */
@@ -0,0 +1,330 @@
+//  simd fractional delay line
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef SIMD_DELAY_HPP
+#define SIMD_DELAY_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+#include "vec.hpp"
+#include "detail/aligned_buffer.hpp"
+#include "detail/interpolation.hpp"
+#include "detail/wrap_argument_vector.hpp"
+
+namespace nova {
+
+/* delay line with fractional, optionally modulated read positions
+ *
+ * a block is processed by first writing n input samples, then reading any number of outputs from
+ * it. the delay time of output sample i is measured in samples relative to input sample i of the
+ * last written block, so a delay of 0 returns the input. delay times can be a scalar, a vector
+ * (one delay time per sample) or a slope_argument (e.g. for doppler sweeps).
+ *
+ * the delay must be in the range [0, max_delay] for linear interpolation and [1, max_delay] for
+ * hermite and lagrange interpolation, which read one sample ahead of the interpolated position.
+ *
+ * read_simd and read_taps_simd require n to be a multiple of vec<F>::size and vector arguments to be
+ * aligned. the per-lane delay times are resolved with gathers, so each lane can read from an
+ * arbitrary position of the buffer.
+ */
+template <typename F>
+class delay_line
+{
+    typedef vec<F> vec_type;
+
+    delay_line(delay_line const &);
+    delay_line & operator=(delay_line const &);
+
+public:
+    explicit delay_line(unsigned int max_delay, unsigned int max_block_size = 64):
+        max_delay_(max_delay), max_block_size_(max_block_size), write_pos(0), block_start(0), block_size(0)
+    {
+        /* history, block and interpolation guard samples */
+        const unsigned int required = max_delay + max_block_size + 3;
+        unsigned int size = 1;
+        while (size < required)
+            size <<= 1;
+
+        buffer.resize(size);
+        mask = size - 1;
+    }
+
+    void clear(void)
+    {
+        buffer.clear();
+    }
+
+    unsigned int max_delay(void) const
+    {
+        return max_delay_;
+    }
+
+    unsigned int max_block_size(void) const
+    {
+        return max_block_size_;
+    }
+
+    void write(const F * in, unsigned int n)
+    {
+        assert(n <= max_block_size_);
+        const unsigned int size = mask + 1;
+        const unsigned int first = std::min(n, size - write_pos);
+
+        std::memcpy(buffer.data() + write_pos, in, first * sizeof(F));
+        std::memcpy(buffer.data(), in + first, (n - first) * sizeof(F));
+
+        block_start = write_pos;
+        block_size = n;
+        write_pos = (write_pos + n) & mask;
+    }
+
+    /* @{ */
+    /** scalar reads */
+    void read(F * out, F delay, unsigned int n, interpolation_type type = linear_interpolation) const
+    {
+        read_dispatch(out, wrap_argument(delay), n, type);
+    }
+
+    void read(F * out, const F * delay, unsigned int n, interpolation_type type = linear_interpolation) const
+    {
+        read_dispatch(out, wrap_argument(delay), n, type);
+    }
+
+    void read(F * out, detail::scalar_ramp_argument<F> delay, unsigned int n,
+              interpolation_type type = linear_interpolation) const
+    {
+        read_dispatch(out, delay, n, type);
+    }
+    /* @} */
+
+    /* @{ */
+    /** vectorized reads */
+    void read_simd(F * out, F delay, unsigned int n, interpolation_type type = linear_interpolation) const
+    {
+        switch (type) {
+        case linear_interpolation:
+            read_taps_simd_<detail::linear_interpolator<F> >(&out, &delay, 1, n);
+            return;
+
+        case hermite_interpolation:
+            read_taps_simd_<detail::hermite_interpolator<F> >(&out, &delay, 1, n);
+            return;
+
+        case lagrange_interpolation:
+            read_taps_simd_<detail::lagrange_interpolator<F> >(&out, &delay, 1, n);
+            return;
+        }
+    }
+
+    void read_simd(F * out, const F * delay, unsigned int n, interpolation_type type = linear_interpolation) const
+    {
+        read_simd_dispatch(out, detail::wrap_vector_arg(wrap_argument(delay)), n, type);
+    }
+
+    void read_simd(F * out, detail::scalar_ramp_argument<F> delay, unsigned int n,
+                   interpolation_type type = linear_interpolation) const
+    {
+        read_simd_dispatch(out, detail::wrap_vector_arg(delay), n, type);
+    }
+    /* @} */
+
+    /* read tap_count taps with fixed delay times in a single pass over the block. outs[k] receives the
+     * tap with delay time delays[k]. */
+    void read_taps_simd(F * const * outs, const F * delays, unsigned int tap_count, unsigned int n,
+                        interpolation_type type = linear_interpolation) const
+    {
+        switch (type) {
+        case linear_interpolation:
+            read_taps_simd_<detail::linear_interpolator<F> >(outs, delays, tap_count, n);
+            return;
+
+        case hermite_interpolation:
+            read_taps_simd_<detail::hermite_interpolator<F> >(outs, delays, tap_count, n);
+            return;
+
+        case lagrange_interpolation:
+            read_taps_simd_<detail::lagrange_interpolator<F> >(outs, delays, tap_count, n);
+            return;
+        }
+    }
+
+private:
+    /* the interpolators are evaluated from the newer sample y0 = x[r] towards the older sample
+     * y1 = x[r-1], where r is the position of the integer part of the delay */
+
+    template <typename Arg>
+    void read_dispatch(F * out, Arg delay, unsigned int n, interpolation_type type) const
+    {
+        switch (type) {
+        case linear_interpolation:
+            read_<detail::linear_interpolator<F> >(out, delay, n);
+            return;
+
+        case hermite_interpolation:
+            read_<detail::hermite_interpolator<F> >(out, delay, n);
+            return;
+
+        case lagrange_interpolation:
+            read_<detail::lagrange_interpolator<F> >(out, delay, n);
+            return;
+        }
+    }
+
+    template <typename Arg>
+    void read_simd_dispatch(F * out, Arg delay, unsigned int n, interpolation_type type) const
+    {
+        switch (type) {
+        case linear_interpolation:
+            read_simd_<detail::linear_interpolator<F> >(out, delay, n);
+            return;
+
+        case hermite_interpolation:
+            read_simd_<detail::hermite_interpolator<F> >(out, delay, n);
+            return;
+
+        case lagrange_interpolation:
+            read_simd_<detail::lagrange_interpolator<F> >(out, delay, n);
+            return;
+        }
+    }
+
+    template <typename Interpolator, typename Arg>
+    void read_(F * out, Arg delay, unsigned int n) const
+    {
+        assert(n <= block_size);
+        const F * buf = buffer.data();
+        Interpolator interpolate;
+
+        for (unsigned int i = 0; i != n; ++i) {
+            const F d = delay.consume();
+            assert(d >= F(0) && d <= F(max_delay_));
+            const F integer_part = std::floor(d);
+            const unsigned int r = block_start + i - (unsigned int)integer_part;
+
+            F ym1 = 0, y2 = 0;
+            if (Interpolator::points == 4) {
+                ym1 = buf[(r + 1) & mask];
+                y2  = buf[(r - 2) & mask];
+            }
+            out[i] = interpolate(ym1, buf[r & mask], buf[(r - 1) & mask], y2, d - integer_part);
+        }
+    }
+
+    template <typename Interpolator, typename Arg>
+    void read_simd_(F * out, Arg delay, unsigned int n) const
+    {
+        assert(n <= block_size);
+        const int vec_size = vec_type::size;
+        const F * buf = buffer.data();
+        Interpolator interpolate;
+
+        F integer_parts[vec_size];
+        int index_m1[vec_size], index_0[vec_size], index_1[vec_size], index_2[vec_size];
+
+        for (unsigned int i = 0; i != n; i += vec_size) {
+            const vec_type d = delay.consume();
+            const vec_type integer_part = floor(d);
+            integer_part.store(integer_parts);
+
+            for (int lane = 0; lane != vec_size; ++lane) {
+                const unsigned int r = block_start + i + lane - (unsigned int)integer_parts[lane];
+                index_m1[lane] = (r + 1) & mask;
+                index_0[lane]  = r & mask;
+                index_1[lane]  = (r - 1) & mask;
+                index_2[lane]  = (r - 2) & mask;
+            }
+
+            vec_type ym1, y0, y1, y2;
+            y0.gather(buf, index_0);
+            y1.gather(buf, index_1);
+            if (Interpolator::points == 4) {
+                ym1.gather(buf, index_m1);
+                y2.gather(buf, index_2);
+            }
+
+            vec_type result = interpolate(ym1, y0, y1, y2, d - integer_part);
+            result.store_aligned(out + i);
+        }
+    }
+
+    /* for fixed delay times, the lanes of a vector read adjacent samples. unless the vector straddles
+     * the end of the buffer, they are fetched with unaligned loads instead of gathers */
+    template <typename Interpolator>
+    void read_taps_simd_(F * const * outs, const F * delays, unsigned int tap_count, unsigned int n) const
+    {
+        assert(n <= block_size);
+        const int vec_size = vec_type::size;
+        const unsigned int size = mask + 1;
+        const F * buf = buffer.data();
+        Interpolator interpolate;
+
+        int index_m1[vec_size], index_0[vec_size], index_1[vec_size], index_2[vec_size];
+
+        for (unsigned int i = 0; i != n; i += vec_size) {
+            for (unsigned int tap = 0; tap != tap_count; ++tap) {
+                const F d = delays[tap];
+                assert(d >= F(0) && d <= F(max_delay_));
+                const F integer_part = std::floor(d);
+                const vec_type t(d - integer_part);
+
+                /* samples are loaded in ascending order, so the lanes of y2 start at the oldest sample */
+                const unsigned int r = block_start + i - (unsigned int)integer_part;
+                const unsigned int first = (r - 2) & mask;
+
+                vec_type ym1, y0, y1, y2;
+                if (first + vec_size + 3 <= size) {
+                    const F * base = buf + first;
+                    y1.load(base + 1);
+                    y0.load(base + 2);
+                    if (Interpolator::points == 4) {
+                        y2.load(base);
+                        ym1.load(base + 3);
+                    }
+                } else {
+                    for (int lane = 0; lane != vec_size; ++lane) {
+                        index_m1[lane] = (r + lane + 1) & mask;
+                        index_0[lane]  = (r + lane) & mask;
+                        index_1[lane]  = (r + lane - 1) & mask;
+                        index_2[lane]  = (r + lane - 2) & mask;
+                    }
+                    y0.gather(buf, index_0);
+                    y1.gather(buf, index_1);
+                    if (Interpolator::points == 4) {
+                        ym1.gather(buf, index_m1);
+                        y2.gather(buf, index_2);
+                    }
+                }
+
+                vec_type result = interpolate(ym1, y0, y1, y2, t);
+                result.store_aligned(outs[tap] + i);
+            }
+        }
+    }
+
+    detail::aligned_buffer<F> buffer;
+    const unsigned int max_delay_, max_block_size_;
+    unsigned int mask;
+    unsigned int write_pos, block_start, block_size;
+};
+
+} /* namespace nova */
+
+#endif /* SIMD_DELAY_HPP */
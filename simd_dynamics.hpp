@@ -0,0 +1,307 @@
+//  simd dynamics processing
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef SIMD_DYNAMICS_HPP
+#define SIMD_DYNAMICS_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+#include "vec.hpp"
+#include "simd_peakmeter.hpp"
+#include "simd_unit_conversion.hpp"
+#include "detail/aligned_buffer.hpp"
+#include "detail/define_macros.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+namespace nova {
+namespace detail {
+
+/* gain of a compressor with soft knee for a level, threshold and knee width in dB
+ *
+ * below threshold - knee/2 the gain is 1, above threshold + knee/2 the level is reduced by the
+ * ratio, in the knee the gain reduction grows quadratically. */
+struct compressor_gain
+{
+    template <typename FloatType>
+    always_inline FloatType operator()(FloatType level, FloatType threshold, FloatType ratio, FloatType knee) const
+    {
+        const FloatType over = amp2db()(std::max(level, FloatType(1e-20))) - threshold;
+        const FloatType slope = FloatType(1) / ratio - FloatType(1);
+        const FloatType half_knee = knee * FloatType(0.5);
+
+        FloatType reduction;
+        if (over > half_knee)
+            reduction = slope * over;
+        else if (over > -half_knee) {
+            const FloatType in_knee = over + half_knee;
+            reduction = slope * in_knee * in_knee / (FloatType(2) * knee);
+        } else
+            return FloatType(1);
+
+        return db2amp()(reduction);
+    }
+
+    template <typename FloatType>
+    always_inline vec<FloatType> operator()(vec<FloatType> level, vec<FloatType> threshold,
+                                            vec<FloatType> ratio, vec<FloatType> knee) const
+    {
+        typedef vec<FloatType> vec_type;
+        const vec_type one(FloatType(1));
+        const vec_type half(FloatType(0.5));
+
+        const vec_type over = amp2db()(max_(level, vec_type(FloatType(1e-20)))) - threshold;
+        const vec_type slope = one / ratio - one;
+        const vec_type half_knee = knee * half;
+        const vec_type in_knee = over + half_knee;
+
+        /* the knee term is not used for knee == 0 */
+        const vec_type knee_reduction = slope * in_knee * in_knee / (knee + knee);
+        const vec_type above_reduction = slope * over;
+
+        vec_type zero;
+        zero.clear();
+        vec_type reduction = select(zero, knee_reduction, mask_gt(over, zero - half_knee));
+        reduction = select(reduction, above_reduction, mask_gt(over, half_knee));
+
+        return db2amp()(reduction);
+    }
+};
+
+}
+
+/* compressor gain computer
+ *
+ * computes the linear gain for a linear level (e.g. of an envelope follower), threshold and knee width
+ * are given in dB. */
+NOVA_SIMD_DEFINE_4ARY_WRAPPER(compressor_gain, detail::compressor_gain)
+
+
+/* lookahead brickwall limiter
+ *
+ * the detection is linked: the peak of all channels is held for lookahead + 1 samples, the gain which
+ * would bring this peak down to the ceiling is released with a one-pole filter and smoothed with a
+ * moving average of lookahead + 1 samples. since both the hold and the average windows start at the
+ * current input and the signal is delayed by lookahead samples, the gain reaches its target before
+ * the peak leaves the delay line and the output does not exceed the ceiling.
+ *
+ * the peak detection, gain computation and the gain application are vectorized in process_simd,
+ * which requires n to be a multiple of vec<F>::size and aligned buffers.
+ */
+template <typename F>
+class lookahead_limiter
+{
+    typedef vec<F> vec_type;
+
+    lookahead_limiter(lookahead_limiter const &);
+    lookahead_limiter & operator=(lookahead_limiter const &);
+
+public:
+    lookahead_limiter(unsigned int channels, unsigned int lookahead, unsigned int max_block_size = 64):
+        channels_(channels), lookahead_(lookahead), window(lookahead + 1), max_block_size_(max_block_size),
+        ceiling_(1), release_(0),
+        delay_lines(channels * (lookahead + max_block_size)), peaks(max_block_size), gains(max_block_size),
+        held_peaks(window), averaged(window)
+    {
+        reset();
+    }
+
+    unsigned int latency(void) const
+    {
+        return lookahead_;
+    }
+
+    /* linear amplitude of the ceiling */
+    void set_ceiling(F ceiling)
+    {
+        ceiling_ = ceiling;
+    }
+
+    /* feedback coefficient of the release filter */
+    void set_release(F coefficient)
+    {
+        release_ = coefficient;
+    }
+
+    void set_release_time(F time)
+    {
+        release_ = time > F(0) ? F(std::exp(-1.0 / time)) : F(0);
+    }
+
+    /* gain of the last processed sample */
+    F gain(void) const
+    {
+        return last_gain;
+    }
+
+    void reset(void)
+    {
+        delay_lines.clear();
+        held_peaks.reset();
+        averaged.clear();
+        average_position = 0;
+        released = F(1);
+        average_sum = F(window);
+        last_gain = F(1);
+        for (unsigned int i = 0; i != window; ++i)
+            averaged[i] = F(1);
+    }
+
+    void process(F * const * out, const F * const * in, unsigned int n)
+    {
+        process_<false>(out, in, n);
+    }
+
+    void process_simd(F * const * out, const F * const * in, unsigned int n)
+    {
+        process_<true>(out, in, n);
+    }
+
+private:
+    F * delay_line(unsigned int channel)
+    {
+        return delay_lines.data() + channel * (lookahead_ + max_block_size_);
+    }
+
+    template <bool simd>
+    void process_(F * const * out, const F * const * in, unsigned int n)
+    {
+        assert(n <= max_block_size_);
+
+        for (unsigned int channel = 0; channel != channels_; ++channel)
+            std::memcpy(delay_line(channel) + lookahead_, in[channel], n * sizeof(F));
+
+        if (simd)
+            detect_simd(in, n);
+        else
+            detect(in, n);
+
+        smooth_gain(n);
+
+        for (unsigned int channel = 0; channel != channels_; ++channel) {
+            F * line = delay_line(channel);
+            if (simd) {
+                for (unsigned int i = 0; i != n; i += vec_type::size) {
+                    vec_type delayed, gain;
+                    delayed.load(line + i);
+                    gain.load_aligned(gains.data() + i);
+                    (delayed * gain).store_aligned(out[channel] + i);
+                }
+            } else {
+                for (unsigned int i = 0; i != n; ++i)
+                    out[channel][i] = line[i] * gains[i];
+            }
+            std::memmove(line, line + n, lookahead_ * sizeof(F));
+        }
+    }
+
+    /* the gain which limits the peak of all channels to the ceiling */
+    void detect(const F * const * in, unsigned int n)
+    {
+        for (unsigned int i = 0; i != n; ++i) {
+            F peak = 0;
+            for (unsigned int channel = 0; channel != channels_; ++channel)
+                peak = std::max(peak, std::fabs(in[channel][i]));
+            peaks[i] = peak;
+        }
+
+        held_peaks.process(peaks.data(), peaks.data(), n);
+
+        for (unsigned int i = 0; i != n; ++i)
+            gains[i] = ceiling_ / std::max(peaks[i], ceiling_);
+    }
+
+    void detect_simd(const F * const * in, unsigned int n)
+    {
+        assert(n % vec_type::size == 0);
+        for (unsigned int i = 0; i != n; i += vec_type::size) {
+            vec_type peak;
+            peak.clear();
+            for (unsigned int channel = 0; channel != channels_; ++channel) {
+                vec_type sample;
+                sample.load_aligned(in[channel] + i);
+                peak = max_(peak, abs(sample));
+            }
+            peak.store_aligned(peaks.data() + i);
+        }
+
+        held_peaks.process_simd(peaks.data(), peaks.data(), n);
+
+        const vec_type ceiling(ceiling_);
+        for (unsigned int i = 0; i != n; i += vec_type::size) {
+            vec_type held;
+            held.load_aligned(peaks.data() + i);
+            (ceiling / max_(held, ceiling)).store_aligned(gains.data() + i);
+        }
+    }
+
+    /* release filter and moving average */
+    void smooth_gain(unsigned int n)
+    {
+        const F scale = F(1) / F(window);
+        F value = released;
+        F sum = average_sum;
+        unsigned int position = average_position;
+
+        for (unsigned int i = 0; i != n; ++i) {
+            const F target = gains[i];
+            value = std::min(target, target + release_ * (value - target));
+
+            sum += value - averaged[position];
+            averaged[position] = value;
+            position = (position + 1 == window) ? 0 : position + 1;
+
+            gains[i] = std::min(sum * scale, F(1));
+        }
+
+        /* avoid the accumulation of rounding errors */
+        sum = 0;
+        for (unsigned int i = 0; i != window; ++i)
+            sum += averaged[i];
+
+        released = value;
+        average_sum = sum;
+        average_position = position;
+        if (n)
+            last_gain = gains[n - 1];
+    }
+
+    const unsigned int channels_, lookahead_, window, max_block_size_;
+    F ceiling_, release_;
+
+    detail::aligned_buffer<F> delay_lines;  /* lookahead samples history, followed by the input */
+    detail::aligned_buffer<F> peaks, gains;
+
+    sliding_window_max<F> held_peaks;
+    detail::aligned_buffer<F> averaged;     /* released gains of the moving average window */
+    unsigned int average_position;
+    F released, average_sum, last_gain;
+};
+
+} /* namespace nova */
+
+#undef always_inline
+
+#endif /* SIMD_DYNAMICS_HPP */
@@ -0,0 +1,247 @@
+//  simd envelope followers
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef SIMD_ENVELOPE_HPP
+#define SIMD_ENVELOPE_HPP
+
+#include <cassert>
+#include <cmath>
+
+#include "vec.hpp"
+#include "detail/aligned_buffer.hpp"
+#include "detail/interleave_network.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+namespace nova {
+
+enum envelope_detection
+{
+    peak_detection,             /* follows the absolute value */
+    rms_detection               /* follows the mean square, outputs its square root */
+};
+
+/* bank of attack/release envelope followers
+ *
+ * the recursion env = level + coefficient * (env - level) is computed for vec<F>::size channels in
+ * parallel, one channel per lane. the attack coefficient is used while the level is above the
+ * envelope, the release coefficient otherwise. coefficients are the feedback factors of one-pole
+ * filters, time_to_coefficient converts time constants.
+ *
+ * new coefficients are reached with a linear ramp during the next call of process, reset() applies
+ * them immediately.
+ *
+ * in and out are arrays of channels() buffers. process_simd transposes blocks of vec<F>::size
+ * samples, so n must be a multiple of vec<F>::size and the buffers must be aligned. both versions
+ * compute the same results.
+ */
+template <typename F>
+class envelope_follower_bank
+{
+    typedef vec<F> vec_type;
+    static const unsigned int vec_size = vec_type::size;
+
+    envelope_follower_bank(envelope_follower_bank const &);
+    envelope_follower_bank & operator=(envelope_follower_bank const &);
+
+public:
+    explicit envelope_follower_bank(unsigned int channels, envelope_detection detection = peak_detection):
+        channels_(channels), padded_channels((channels + vec_size - 1) / vec_size * vec_size),
+        detection_(detection),
+        envelope(padded_channels), attack(padded_channels), release(padded_channels),
+        attack_target(padded_channels), release_target(padded_channels),
+        zeros(vec_size), discard(vec_size)
+    {}
+
+    unsigned int channels(void) const
+    {
+        return channels_;
+    }
+
+    /* coefficient of a one-pole filter, which decays by 1/e within time samples */
+    static F time_to_coefficient(F time)
+    {
+        return time > F(0) ? F(std::exp(-1.0 / time)) : F(0);
+    }
+
+    /* @{ */
+    /** coefficients, ramped during the next block */
+    void set_attack(unsigned int channel, F coefficient)
+    {
+        assert(channel < channels_);
+        attack_target[channel] = coefficient;
+    }
+
+    void set_release(unsigned int channel, F coefficient)
+    {
+        assert(channel < channels_);
+        release_target[channel] = coefficient;
+    }
+
+    void set_attack_time(unsigned int channel, F time)
+    {
+        set_attack(channel, time_to_coefficient(time));
+    }
+
+    void set_release_time(unsigned int channel, F time)
+    {
+        set_release(channel, time_to_coefficient(time));
+    }
+    /* @} */
+
+    F value(unsigned int channel) const
+    {
+        assert(channel < channels_);
+        return detection_ == rms_detection ? std::sqrt(envelope[channel]) : envelope[channel];
+    }
+
+    /* clear the envelopes and jump to the target coefficients */
+    void reset(void)
+    {
+        envelope.clear();
+        for (unsigned int channel = 0; channel != padded_channels; ++channel) {
+            attack[channel] = attack_target[channel];
+            release[channel] = release_target[channel];
+        }
+    }
+
+    void process(F * const * out, const F * const * in, unsigned int n)
+    {
+        if (n == 0)
+            return;
+
+        for (unsigned int channel = 0; channel != channels_; ++channel) {
+            const F attack_slope = (attack_target[channel] - attack[channel]) / F(n);
+            const F release_slope = (release_target[channel] - release[channel]) / F(n);
+            F attack_coefficient = attack[channel];
+            F release_coefficient = release[channel];
+            F env = envelope[channel];
+
+            for (unsigned int i = 0; i != n; ++i) {
+                attack_coefficient += attack_slope;
+                release_coefficient += release_slope;
+
+                const F level = detect(in[channel][i]);
+                const F coefficient = level > env ? attack_coefficient : release_coefficient;
+                env = level + coefficient * (env - level);
+                out[channel][i] = output(env);
+            }
+
+            envelope[channel] = env;
+        }
+        apply_targets();
+    }
+
+    void process_simd(F * const * out, const F * const * in, unsigned int n)
+    {
+        assert(n % vec_size == 0);
+        if (n == 0)
+            return;
+
+        const vec_type block_size = vec_type(F(n));
+        for (unsigned int group = 0; group != padded_channels; group += vec_size) {
+            vec_type attack_coefficient, release_coefficient, env, attack_target_vec, release_target_vec;
+            attack_coefficient.load_aligned(attack.data() + group);
+            release_coefficient.load_aligned(release.data() + group);
+            attack_target_vec.load_aligned(attack_target.data() + group);
+            release_target_vec.load_aligned(release_target.data() + group);
+            env.load_aligned(envelope.data() + group);
+
+            const vec_type attack_slope = (attack_target_vec - attack_coefficient) / block_size;
+            const vec_type release_slope = (release_target_vec - release_coefficient) / block_size;
+
+            /* unused lanes read zeros and write to a scratch vector */
+            const F * group_in[vec_size];
+            F * group_out[vec_size];
+            unsigned int stride[vec_size];
+            for (unsigned int lane = 0; lane != vec_size; ++lane) {
+                const bool used = group + lane < channels_;
+                group_in[lane] = used ? in[group + lane] : zeros.data();
+                group_out[lane] = used ? out[group + lane] : discard.data();
+                stride[lane] = used ? 1 : 0;
+            }
+
+            for (unsigned int i = 0; i != n; i += vec_size) {
+                vec_type samples[vec_size], frames[vec_size];
+                for (unsigned int lane = 0; lane != vec_size; ++lane)
+                    samples[lane].load_aligned(group_in[lane] + i * stride[lane]);
+
+                detail::interleave_network<vec_size>::interleave_vectors(frames, samples, 1);
+
+                for (unsigned int frame = 0; frame != vec_size; ++frame) {
+                    attack_coefficient += attack_slope;
+                    release_coefficient += release_slope;
+
+                    const vec_type level = detect(frames[frame]);
+                    const vec_type coefficient = select(release_coefficient, attack_coefficient, mask_gt(level, env));
+                    env = level + coefficient * (env - level);
+                    frames[frame] = output(env);
+                }
+
+                detail::interleave_network<vec_size>::deinterleave_vectors(samples, frames, 1);
+
+                for (unsigned int lane = 0; lane != vec_size; ++lane)
+                    samples[lane].store_aligned(group_out[lane] + i * stride[lane]);
+            }
+
+            env.store_aligned(envelope.data() + group);
+        }
+        apply_targets();
+    }
+
+private:
+    template <typename Arg>
+    always_inline Arg detect(Arg sample) const
+    {
+        using std::abs;
+        return detection_ == rms_detection ? sample * sample : abs(sample);
+    }
+
+    template <typename Arg>
+    always_inline Arg output(Arg env) const
+    {
+        using std::sqrt;
+        return detection_ == rms_detection ? sqrt(env) : env;
+    }
+
+    void apply_targets(void)
+    {
+        for (unsigned int channel = 0; channel != padded_channels; ++channel) {
+            attack[channel] = attack_target[channel];
+            release[channel] = release_target[channel];
+        }
+    }
+
+    const unsigned int channels_, padded_channels;
+    const envelope_detection detection_;
+
+    detail::aligned_buffer<F> envelope;
+    detail::aligned_buffer<F> attack, release;
+    detail::aligned_buffer<F> attack_target, release_target;
+    detail::aligned_buffer<F> zeros, discard;
+};
+
+} /* namespace nova */
+
+#undef always_inline
+
+#endif /* SIMD_ENVELOPE_HPP */
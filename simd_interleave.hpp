@@ -0,0 +1,297 @@
+//  simd functions for interleaving and deinterleaving multichannel buffers
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef SIMD_INTERLEAVE_HPP
+#define SIMD_INTERLEAVE_HPP
+
+#include <cassert>
+
+#include "vec.hpp"
+#include "detail/interleave_network.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+namespace nova {
+namespace detail {
+
+template <bool Scaled, typename F>
+always_inline F scale_sample(F sample, F gain)
+{
+    return Scaled ? sample * gain : sample;
+}
+
+template <bool Scaled, typename F>
+inline void interleave_vec(F * out, const F * const * in, unsigned int channels, F gain, unsigned int n)
+{
+    for (unsigned int channel = 0; channel != channels; ++channel) {
+        const F * channel_in = in[channel];
+        F * channel_out = out + channel;
+        for (unsigned int i = 0; i != n; ++i)
+            channel_out[i * channels] = scale_sample<Scaled>(channel_in[i], gain);
+    }
+}
+
+template <bool Scaled, typename F>
+inline void deinterleave_vec(F * const * out, const F * in, unsigned int channels, F gain, unsigned int n)
+{
+    for (unsigned int channel = 0; channel != channels; ++channel) {
+        const F * channel_in = in + channel;
+        F * channel_out = out[channel];
+        for (unsigned int i = 0; i != n; ++i)
+            channel_out[i] = scale_sample<Scaled>(channel_in[i * channels], gain);
+    }
+}
+
+/* Channels must be a power of two */
+template <int Channels, bool Scaled, typename F>
+inline void interleave_vec_simd(F * out, const F * const * in, F gain, unsigned int n)
+{
+    typedef vec<F> vec_type;
+    const unsigned int vec_size = vec_type::size;
+    const vec_type vector_gain(gain);
+
+    for (unsigned int i = 0; i != n; i += vec_size) {
+        vec_type planar[Channels], frames[Channels];
+        for (int channel = 0; channel != Channels; ++channel) {
+            planar[channel].load_aligned(in[channel] + i);
+            if (Scaled)
+                planar[channel] = planar[channel] * vector_gain;
+        }
+
+        interleave_network<Channels>::interleave_vectors(frames, planar, 1);
+
+        for (int j = 0; j != Channels; ++j)
+            frames[j].store(out + i * Channels + j * vec_size);
+    }
+}
+
+template <int Channels, bool Scaled, typename F>
+inline void deinterleave_vec_simd(F * const * out, const F * in, F gain, unsigned int n)
+{
+    typedef vec<F> vec_type;
+    const unsigned int vec_size = vec_type::size;
+    const vec_type vector_gain(gain);
+
+    for (unsigned int i = 0; i != n; i += vec_size) {
+        vec_type planar[Channels], frames[Channels];
+        for (int j = 0; j != Channels; ++j)
+            frames[j].load(in + i * Channels + j * vec_size);
+
+        interleave_network<Channels>::deinterleave_vectors(planar, frames, 1);
+
+        for (int channel = 0; channel != Channels; ++channel) {
+            if (Scaled)
+                planar[channel] = planar[channel] * vector_gain;
+            planar[channel].store_aligned(out[channel] + i);
+        }
+    }
+}
+
+/* 6 channels are transposed as 8 channels, the frames are compacted in a small buffer */
+template <bool Scaled, typename F>
+inline void interleave6_vec_simd(F * out, const F * const * in, F gain, unsigned int n)
+{
+    typedef vec<F> vec_type;
+    const unsigned int vec_size = vec_type::size;
+    const vec_type vector_gain(gain);
+
+    vec_type planar[8], frames[8];
+    planar[6].clear();
+    planar[7].clear();
+    F buffer[8 * vec_size];
+
+    for (unsigned int i = 0; i != n; i += vec_size) {
+        for (int channel = 0; channel != 6; ++channel) {
+            planar[channel].load_aligned(in[channel] + i);
+            if (Scaled)
+                planar[channel] = planar[channel] * vector_gain;
+        }
+
+        interleave_network<8>::interleave_vectors(frames, planar, 1);
+
+        for (int j = 0; j != 8; ++j)
+            frames[j].store(buffer + j * vec_size);
+        for (unsigned int frame = 0; frame != vec_size; ++frame)
+            for (int channel = 0; channel != 6; ++channel)
+                out[(i + frame) * 6 + channel] = buffer[frame * 8 + channel];
+    }
+}
+
+template <bool Scaled, typename F>
+inline void deinterleave6_vec_simd(F * const * out, const F * in, F gain, unsigned int n)
+{
+    typedef vec<F> vec_type;
+    const unsigned int vec_size = vec_type::size;
+    const vec_type vector_gain(gain);
+
+    vec_type planar[8], frames[8];
+    F buffer[8 * vec_size];
+    for (unsigned int frame = 0; frame != vec_size; ++frame)
+        buffer[frame * 8 + 6] = buffer[frame * 8 + 7] = F(0);
+
+    for (unsigned int i = 0; i != n; i += vec_size) {
+        for (unsigned int frame = 0; frame != vec_size; ++frame)
+            for (int channel = 0; channel != 6; ++channel)
+                buffer[frame * 8 + channel] = in[(i + frame) * 6 + channel];
+        for (int j = 0; j != 8; ++j)
+            frames[j].load(buffer + j * vec_size);
+
+        interleave_network<8>::deinterleave_vectors(planar, frames, 1);
+
+        for (int channel = 0; channel != 6; ++channel) {
+            if (Scaled)
+                planar[channel] = planar[channel] * vector_gain;
+            planar[channel].store_aligned(out[channel] + i);
+        }
+    }
+}
+
+template <bool Scaled, typename F>
+inline void interleave_vec_simd(F * out, const F * const * in, unsigned int channels, F gain, unsigned int n)
+{
+    assert(n % vec<F>::size == 0);
+    switch (channels) {
+    case 1:
+        interleave_vec_simd<1, Scaled>(out, in, gain, n);
+        return;
+
+    case 2:
+        interleave_vec_simd<2, Scaled>(out, in, gain, n);
+        return;
+
+    case 4:
+        interleave_vec_simd<4, Scaled>(out, in, gain, n);
+        return;
+
+    case 6:
+        interleave6_vec_simd<Scaled>(out, in, gain, n);
+        return;
+
+    case 8:
+        interleave_vec_simd<8, Scaled>(out, in, gain, n);
+        return;
+
+    default:
+        interleave_vec<Scaled>(out, in, channels, gain, n);
+    }
+}
+
+template <bool Scaled, typename F>
+inline void deinterleave_vec_simd(F * const * out, const F * in, unsigned int channels, F gain, unsigned int n)
+{
+    assert(n % vec<F>::size == 0);
+    switch (channels) {
+    case 1:
+        deinterleave_vec_simd<1, Scaled>(out, in, gain, n);
+        return;
+
+    case 2:
+        deinterleave_vec_simd<2, Scaled>(out, in, gain, n);
+        return;
+
+    case 4:
+        deinterleave_vec_simd<4, Scaled>(out, in, gain, n);
+        return;
+
+    case 6:
+        deinterleave6_vec_simd<Scaled>(out, in, gain, n);
+        return;
+
+    case 8:
+        deinterleave_vec_simd<8, Scaled>(out, in, gain, n);
+        return;
+
+    default:
+        deinterleave_vec<Scaled>(out, in, channels, gain, n);
+    }
+}
+
+}
+
+/* interleave/deinterleave multichannel buffers
+ *
+ * in (interleave) and out (deinterleave) are arrays of channels planar buffers, the interleaved
+ * buffer holds n frames of channels samples. the versions with a gain argument scale the samples
+ * while they are shuffled.
+ *
+ * the _simd versions transpose the samples in registers for 1, 2, 4, 6 and 8 channels and fall back
+ * to the scalar code for other channel counts. they require n to be a multiple of vec<F>::size and
+ * the planar buffers to be aligned, the interleaved buffer does not need to be aligned.
+ */
+
+/* @{ */
+template <typename F>
+inline void interleave_vec(F * out, const F * const * in, unsigned int channels, unsigned int n)
+{
+    detail::interleave_vec<false>(out, in, channels, F(1), n);
+}
+
+template <typename F>
+inline void interleave_vec(F * out, const F * const * in, unsigned int channels, F gain, unsigned int n)
+{
+    detail::interleave_vec<true>(out, in, channels, gain, n);
+}
+
+template <typename F>
+inline void interleave_vec_simd(F * out, const F * const * in, unsigned int channels, unsigned int n)
+{
+    detail::interleave_vec_simd<false>(out, in, channels, F(1), n);
+}
+
+template <typename F>
+inline void interleave_vec_simd(F * out, const F * const * in, unsigned int channels, F gain, unsigned int n)
+{
+    detail::interleave_vec_simd<true>(out, in, channels, gain, n);
+}
+/* @} */
+
+/* @{ */
+template <typename F>
+inline void deinterleave_vec(F * const * out, const F * in, unsigned int channels, unsigned int n)
+{
+    detail::deinterleave_vec<false>(out, in, channels, F(1), n);
+}
+
+template <typename F>
+inline void deinterleave_vec(F * const * out, const F * in, unsigned int channels, F gain, unsigned int n)
+{
+    detail::deinterleave_vec<true>(out, in, channels, gain, n);
+}
+
+template <typename F>
+inline void deinterleave_vec_simd(F * const * out, const F * in, unsigned int channels, unsigned int n)
+{
+    detail::deinterleave_vec_simd<false>(out, in, channels, F(1), n);
+}
+
+template <typename F>
+inline void deinterleave_vec_simd(F * const * out, const F * in, unsigned int channels, F gain, unsigned int n)
+{
+    detail::deinterleave_vec_simd<true>(out, in, channels, gain, n);
+}
+/* @} */
+
+} /* namespace nova */
+
+#undef always_inline
+
+#endif /* SIMD_INTERLEAVE_HPP */
@@ -0,0 +1,352 @@
+//  simd loudness meter (ITU-R BS.1770)
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef SIMD_LOUDNESS_HPP
+#define SIMD_LOUDNESS_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+#include "vec.hpp"
+#include "detail/aligned_buffer.hpp"
+#include "detail/interleave_network.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+namespace nova {
+namespace detail {
+
+/* coefficients of a biquad in transposed direct form 2, a0 is normalized to 1 */
+struct biquad_coefficients
+{
+    double b0, b1, b2, a1, a2;
+};
+
+/* high shelf of the k-weighting pre-filter, the analog prototype is mapped to the sample rate */
+inline biquad_coefficients k_weighting_shelf(double samplerate)
+{
+    const double pi = 3.141592653589793238462643383279502884197;
+    const double f0 = 1681.974450955533;
+    const double gain = 3.999843853973347;
+    const double q = 0.7071752369554196;
+
+    const double k = std::tan(pi * f0 / samplerate);
+    const double vh = std::pow(10.0, gain / 20.0);
+    const double vb = std::pow(vh, 0.4996667741545416);
+    const double a0 = 1.0 + k / q + k * k;
+
+    biquad_coefficients ret;
+    ret.b0 = (vh + vb * k / q + k * k) / a0;
+    ret.b1 = 2.0 * (k * k - vh) / a0;
+    ret.b2 = (vh - vb * k / q + k * k) / a0;
+    ret.a1 = 2.0 * (k * k - 1.0) / a0;
+    ret.a2 = (1.0 - k / q + k * k) / a0;
+    return ret;
+}
+
+/* revised low-frequency b-curve (rlb), a second order highpass */
+inline biquad_coefficients k_weighting_highpass(double samplerate)
+{
+    const double pi = 3.141592653589793238462643383279502884197;
+    const double f0 = 38.13547087602444;
+    const double q = 0.5003270373238773;
+
+    const double k = std::tan(pi * f0 / samplerate);
+    const double a0 = 1.0 + k / q + k * k;
+
+    biquad_coefficients ret;
+    ret.b0 = 1.0;
+    ret.b1 = -2.0;
+    ret.b2 = 1.0;
+    ret.a1 = 2.0 * (k * k - 1.0) / a0;
+    ret.a2 = (1.0 - k / q + k * k) / a0;
+    return ret;
+}
+
+}
+
+/* loudness meter according to ITU-R BS.1770 / EBU R 128
+ *
+ * the channels are k-weighted and their mean square is accumulated over sub-blocks of 100 ms. the
+ * momentary loudness covers the last 4 sub-blocks (400 ms), the short-term loudness the last 30
+ * (3 s). every 400 ms block, which passes the absolute gate of -70 LUFS, is added to a histogram
+ * with a resolution of 0.1 LU, so the integrated loudness with the relative gate of -10 LU can be
+ * computed at any time without storing the block history.
+ *
+ * process_simd filters vec<F>::size channels in parallel, one channel per lane, so n must be a
+ * multiple of vec<F>::size and the input buffers must be aligned. blocks must not be larger than
+ * max_block_size, which must not exceed a sub-block.
+ */
+template <typename F>
+class loudness_meter
+{
+    typedef vec<F> vec_type;
+    static const unsigned int vec_size = vec_type::size;
+
+    static const unsigned int momentary_subblocks = 4;
+    static const unsigned int short_term_subblocks = 30;
+    static const unsigned int histogram_bins = 1000;   /* -70 to +30 LUFS */
+
+    loudness_meter(loudness_meter const &);
+    loudness_meter & operator=(loudness_meter const &);
+
+public:
+    loudness_meter(unsigned int channels, double samplerate, unsigned int max_block_size = 64):
+        channels_(channels), padded_channels((channels + vec_size - 1) / vec_size * vec_size),
+        subblock_size((unsigned int)(samplerate * 0.1 + 0.5)), max_block_size_(max_block_size),
+        weights(padded_channels), shelf_s1_state(padded_channels), shelf_s2_state(padded_channels),
+        highpass_s1_state(padded_channels), highpass_s2_state(padded_channels),
+        energy(padded_channels), completed(padded_channels), zeros(max_block_size),
+        subblock_energies(short_term_subblocks), histogram_count(histogram_bins), histogram_energy(histogram_bins)
+    {
+        assert(max_block_size <= subblock_size);
+        shelf = detail::k_weighting_shelf(samplerate);
+        highpass = detail::k_weighting_highpass(samplerate);
+
+        for (unsigned int channel = 0; channel != channels_; ++channel)
+            weights[channel] = F(1);
+        reset();
+    }
+
+    unsigned int channels(void) const
+    {
+        return channels_;
+    }
+
+    /* weight of the channel energy, 1.41 for surround channels, 0 to exclude a channel (lfe) */
+    void set_channel_weight(unsigned int channel, F weight)
+    {
+        assert(channel < channels_);
+        weights[channel] = weight;
+    }
+
+    void reset(void)
+    {
+        shelf_s1_state.clear();
+        shelf_s2_state.clear();
+        highpass_s1_state.clear();
+        highpass_s2_state.clear();
+        energy.clear();
+        subblock_energies.clear();
+        histogram_count.clear();
+        histogram_energy.clear();
+        subblock_position = 0;
+        subblock_index = 0;
+        subblocks = 0;
+        gated_blocks = 0;
+        gated_energy = 0;
+    }
+
+    /* @{ */
+    /** loudness in LUFS, -infinity for silence */
+    double momentary(void) const
+    {
+        return window_loudness(momentary_subblocks);
+    }
+
+    double short_term(void) const
+    {
+        return window_loudness(short_term_subblocks);
+    }
+
+    double integrated(void) const
+    {
+        if (gated_blocks == 0)
+            return -std::numeric_limits<double>::infinity();
+
+        const double relative_gate = energy_to_loudness(gated_energy / gated_blocks) - 10.0;
+        const int first_bin = std::max(0, int(std::floor((relative_gate + 70.0) * 10.0)));
+
+        double sum = 0;
+        double count = 0;
+        for (unsigned int bin = first_bin; bin < histogram_bins; ++bin) {
+            sum += histogram_energy[bin];
+            count += histogram_count[bin];
+        }
+        return count != 0 ? energy_to_loudness(sum / count) : -std::numeric_limits<double>::infinity();
+    }
+    /* @} */
+
+    void process(const F * const * in, unsigned int n)
+    {
+        assert(n <= max_block_size_);
+        const unsigned int boundary = subblock_size - subblock_position;
+
+        for (unsigned int channel = 0; channel != channels_; ++channel) {
+            F shelf_s1 = shelf_s1_state[channel], shelf_s2 = shelf_s2_state[channel];
+            F highpass_s1 = highpass_s1_state[channel], highpass_s2 = highpass_s2_state[channel];
+            F sum = energy[channel];
+
+            for (unsigned int i = 0; i != n; ++i) {
+                const F weighted = filter(in[channel][i], shelf_s1, shelf_s2, highpass_s1, highpass_s2);
+                sum += weighted * weighted;
+
+                if (i + 1 == boundary) {
+                    completed[channel] = sum;
+                    sum = 0;
+                }
+            }
+
+            shelf_s1_state[channel] = shelf_s1;
+            shelf_s2_state[channel] = shelf_s2;
+            highpass_s1_state[channel] = highpass_s1;
+            highpass_s2_state[channel] = highpass_s2;
+            energy[channel] = sum;
+        }
+
+        advance(n);
+    }
+
+    void process_simd(const F * const * in, unsigned int n)
+    {
+        assert(n <= max_block_size_);
+        assert(n % vec_size == 0);
+        const unsigned int boundary = subblock_size - subblock_position;
+
+        for (unsigned int group = 0; group != padded_channels; group += vec_size) {
+            vec_type shelf_s1, shelf_s2, highpass_s1, highpass_s2, sum;
+            shelf_s1.load_aligned(shelf_s1_state.data() + group);
+            shelf_s2.load_aligned(shelf_s2_state.data() + group);
+            highpass_s1.load_aligned(highpass_s1_state.data() + group);
+            highpass_s2.load_aligned(highpass_s2_state.data() + group);
+            sum.load_aligned(energy.data() + group);
+
+            const F * group_in[vec_size];
+            for (unsigned int lane = 0; lane != vec_size; ++lane)
+                group_in[lane] = group + lane < channels_ ? in[group + lane] : zeros.data();
+
+            for (unsigned int i = 0; i != n; i += vec_size) {
+                vec_type samples[vec_size], frames[vec_size];
+                for (unsigned int lane = 0; lane != vec_size; ++lane)
+                    samples[lane].load_aligned(group_in[lane] + i);
+
+                detail::interleave_network<vec_size>::interleave_vectors(frames, samples, 1);
+
+                for (unsigned int frame = 0; frame != vec_size; ++frame) {
+                    const vec_type weighted = filter(frames[frame], shelf_s1, shelf_s2, highpass_s1, highpass_s2);
+                    sum += weighted * weighted;
+
+                    if (i + frame + 1 == boundary) {
+                        sum.store_aligned(completed.data() + group);
+                        sum.clear();
+                    }
+                }
+            }
+
+            shelf_s1.store_aligned(shelf_s1_state.data() + group);
+            shelf_s2.store_aligned(shelf_s2_state.data() + group);
+            highpass_s1.store_aligned(highpass_s1_state.data() + group);
+            highpass_s2.store_aligned(highpass_s2_state.data() + group);
+            sum.store_aligned(energy.data() + group);
+        }
+
+        advance(n);
+    }
+
+private:
+    /* k-weighting: shelf and highpass biquads in transposed direct form 2 */
+    template <typename Arg>
+    always_inline Arg filter(Arg sample, Arg & shelf_s1, Arg & shelf_s2, Arg & highpass_s1, Arg & highpass_s2) const
+    {
+        const Arg shelved = Arg(F(shelf.b0)) * sample + shelf_s1;
+        shelf_s1 = Arg(F(shelf.b1)) * sample - Arg(F(shelf.a1)) * shelved + shelf_s2;
+        shelf_s2 = Arg(F(shelf.b2)) * sample - Arg(F(shelf.a2)) * shelved;
+
+        const Arg weighted = shelved + highpass_s1;
+        highpass_s1 = highpass_s2 - shelved - shelved - Arg(F(highpass.a1)) * weighted;
+        highpass_s2 = shelved - Arg(F(highpass.a2)) * weighted;
+        return weighted;
+    }
+
+    static double energy_to_loudness(double mean_square)
+    {
+        return -0.691 + 10.0 * std::log10(mean_square);
+    }
+
+    double window_loudness(unsigned int length) const
+    {
+        double sum = 0;
+        for (unsigned int i = 0; i != length; ++i)
+            sum += subblock_energies[(subblock_index + short_term_subblocks - 1 - i) % short_term_subblocks];
+        return energy_to_loudness(sum / (double(length) * subblock_size));
+    }
+
+    void advance(unsigned int n)
+    {
+        subblock_position += n;
+        if (subblock_position < subblock_size)
+            return;
+        subblock_position -= subblock_size;
+
+        /* weighted sum of the channel energies of the completed sub-block */
+        double sum = 0;
+        for (unsigned int channel = 0; channel != channels_; ++channel)
+            sum += double(weights[channel]) * completed[channel];
+
+        subblock_index = (subblock_index + 1) % short_term_subblocks;
+        subblock_energies[(subblock_index + short_term_subblocks - 1) % short_term_subblocks] = sum;
+        ++subblocks;
+
+        if (subblocks >= momentary_subblocks)
+            gate_block();
+    }
+
+    void gate_block(void)
+    {
+        double sum = 0;
+        for (unsigned int i = 0; i != momentary_subblocks; ++i)
+            sum += subblock_energies[(subblock_index + short_term_subblocks - 1 - i) % short_term_subblocks];
+        const double mean_square = sum / (double(momentary_subblocks) * subblock_size);
+
+        const double loudness = energy_to_loudness(mean_square);
+        if (!(loudness > -70.0))
+            return;
+
+        const unsigned int bin = std::min(unsigned((loudness + 70.0) * 10.0), histogram_bins - 1);
+        histogram_count[bin] += 1;
+        histogram_energy[bin] += mean_square;
+        gated_blocks += 1;
+        gated_energy += mean_square;
+    }
+
+    const unsigned int channels_, padded_channels, subblock_size, max_block_size_;
+    detail::biquad_coefficients shelf, highpass;
+
+    detail::aligned_buffer<F> weights;
+    detail::aligned_buffer<F> shelf_s1_state, shelf_s2_state;         /* filter states */
+    detail::aligned_buffer<F> highpass_s1_state, highpass_s2_state;
+    detail::aligned_buffer<F> energy, completed;             /* squared sums of the current/last sub-block */
+    detail::aligned_buffer<F> zeros;
+
+    detail::aligned_buffer<double> subblock_energies;        /* ring buffer of weighted sub-block energies */
+    detail::aligned_buffer<double> histogram_count, histogram_energy;
+    unsigned int subblock_position, subblock_index, subblocks;
+    double gated_blocks, gated_energy;
+};
+
+} /* namespace nova */
+
+#undef always_inline
+
+#endif /* SIMD_LOUDNESS_HPP */
@@ -0,0 +1,278 @@
+//  simd matrix mixer
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef SIMD_MATRIX_MIXER_HPP
+#define SIMD_MATRIX_MIXER_HPP
+
+#include <cassert>
+#include <vector>
+
+#include "vec.hpp"
+#include "detail/aligned_buffer.hpp"
+
+namespace nova {
+
+/* inputs x outputs matrix mixer with a gain per crosspoint
+ *
+ * set_gain changes the target gain of a crosspoint, the next call to process ramps linearly from the
+ * current to the target gain over the block. the outputs are overwritten, they must not alias the
+ * inputs.
+ *
+ * process_simd tiles the outputs in groups of four and the samples in pairs of vectors, so eight
+ * accumulators stay in registers and each input is loaded once per tile. inputs whose gains are
+ * zero for all outputs of a tile are skipped. ramping tiles use the same tiling, the gains of each
+ * crosspoint advance by a precomputed slope vector. it requires n to be a multiple of vec<F>::size and
+ * aligned buffers.
+ */
+template <typename F>
+class matrix_mixer
+{
+    typedef vec<F> vec_type;
+    static const unsigned int vec_size = vec_type::size;
+    static const unsigned int tile_size = 4;
+
+    matrix_mixer(matrix_mixer const &);
+    matrix_mixer & operator=(matrix_mixer const &);
+
+public:
+    matrix_mixer(unsigned int inputs, unsigned int outputs):
+        inputs_(inputs), outputs_(outputs), current(inputs * outputs), targets(inputs * outputs),
+        vector_gains(inputs * outputs * vec_size), vector_slopes(inputs * outputs * vec_size), active(inputs),
+        ramping_(false)
+    {}
+
+    unsigned int inputs(void) const
+    {
+        return inputs_;
+    }
+
+    unsigned int outputs(void) const
+    {
+        return outputs_;
+    }
+
+    F gain(unsigned int output, unsigned int input) const
+    {
+        return targets[output * inputs_ + input];
+    }
+
+    void set_gain(unsigned int output, unsigned int input, F value)
+    {
+        assert(output < outputs_ && input < inputs_);
+        targets[output * inputs_ + input] = value;
+        ramping_ = true;
+    }
+
+    /* jump to the target gains without ramping */
+    void reset(void)
+    {
+        for (unsigned int index = 0; index != inputs_ * outputs_; ++index)
+            set_current(index, targets[index]);
+        ramping_ = false;
+    }
+
+    void process(F * const * out, const F * const * in, unsigned int n)
+    {
+        const F scale = F(1) / F(n);
+
+        for (unsigned int output = 0; output != outputs_; ++output) {
+            F * dest = out[output];
+            for (unsigned int i = 0; i != n; ++i)
+                dest[i] = 0;
+
+            for (unsigned int input = 0; input != inputs_; ++input) {
+                const unsigned int index = output * inputs_ + input;
+                const F start = current[index];
+                const F slope = (targets[index] - start) * scale;
+                if (start == 0 && slope == 0)
+                    continue;
+
+                const F * src = in[input];
+                for (unsigned int i = 0; i != n; ++i)
+                    dest[i] += src[i] * (start + F(i) * slope);
+            }
+        }
+
+        finish_block();
+    }
+
+    void process_simd(F * const * out, const F * const * in, unsigned int n)
+    {
+        assert(n % vec_size == 0);
+
+        unsigned int output = 0;
+        for (; output + tile_size <= outputs_; output += tile_size)
+            process_tile<tile_size>(out + output, in, output, n);
+
+        switch (outputs_ - output) {
+        case 3:
+            process_tile<3>(out + output, in, output, n);
+            break;
+        case 2:
+            process_tile<2>(out + output, in, output, n);
+            break;
+        case 1:
+            process_tile<1>(out + output, in, output, n);
+            break;
+        default:
+            break;
+        }
+
+        finish_block();
+    }
+
+private:
+    template <unsigned int tile>
+    void process_tile(F * const * out, const F * const * in, unsigned int first_output, unsigned int n)
+    {
+        /* inputs with a non-zero gain for any output of the tile */
+        unsigned int active_count = 0;
+        bool tile_ramping = false;
+        for (unsigned int input = 0; input != inputs_; ++input) {
+            bool used = false;
+            for (unsigned int k = 0; k != tile; ++k) {
+                const unsigned int index = (first_output + k) * inputs_ + input;
+                used = used || current[index] != 0 || targets[index] != 0;
+                tile_ramping = tile_ramping || current[index] != targets[index];
+            }
+            if (used)
+                active[active_count++] = input;
+        }
+
+        if (tile_ramping) {
+            start_ramp<tile>(first_output, active_count, n);
+            process_tile_<tile, true>(out, in, first_output, active_count, n);
+        } else
+            process_tile_<tile, false>(out, in, first_output, active_count, n);
+    }
+
+    /* vector_gains of a ramping crosspoint hold the gains of the first vector of the block,
+     * vector_slopes their increment per vector */
+    template <unsigned int tile>
+    void start_ramp(unsigned int first_output, unsigned int active_count, unsigned int n)
+    {
+        const F scale = F(1) / F(n);
+        for (unsigned int a = 0; a != active_count; ++a) {
+            for (unsigned int k = 0; k != tile; ++k) {
+                const unsigned int index = (first_output + k) * inputs_ + active[a];
+                const F start = current[index];
+                vec_type gain;
+                const F step = gain.set_slope(start, (targets[index] - start) * scale);
+                gain.store_aligned(vector_gains.data() + index * vec_size);
+                vec_type(step).store_aligned(vector_slopes.data() + index * vec_size);
+            }
+        }
+    }
+
+    template <unsigned int tile, bool ramped>
+    void process_tile_(F * const * out, const F * const * in, unsigned int first_output,
+                       unsigned int active_count, unsigned int n)
+    {
+        unsigned int i = 0;
+        for (; i + 2 * vec_size <= n; i += 2 * vec_size) {
+            const vec_type steps(F(i / vec_size));
+            vec_type sum0[tile], sum1[tile];
+            for (unsigned int k = 0; k != tile; ++k) {
+                sum0[k].clear();
+                sum1[k].clear();
+            }
+
+            for (unsigned int a = 0; a != active_count; ++a) {
+                const unsigned int input = active[a];
+                vec_type sig0, sig1;
+                sig0.load_aligned(in[input] + i);
+                sig1.load_aligned(in[input] + i + vec_size);
+
+                for (unsigned int k = 0; k != tile; ++k) {
+                    const unsigned int index = (first_output + k) * inputs_ + input;
+                    vec_type g;
+                    g.load_aligned(vector_gains.data() + index * vec_size);
+                    if (ramped) {
+                        vec_type step;
+                        step.load_aligned(vector_slopes.data() + index * vec_size);
+                        const vec_type g0 = g + step * steps;
+                        sum0[k] += sig0 * g0;
+                        sum1[k] += sig1 * (g0 + step);
+                    } else {
+                        sum0[k] += sig0 * g;
+                        sum1[k] += sig1 * g;
+                    }
+                }
+            }
+
+            for (unsigned int k = 0; k != tile; ++k) {
+                sum0[k].store_aligned(out[k] + i);
+                sum1[k].store_aligned(out[k] + i + vec_size);
+            }
+        }
+
+        if (i != n) {
+            const vec_type steps(F(i / vec_size));
+            vec_type sum[tile];
+            for (unsigned int k = 0; k != tile; ++k)
+                sum[k].clear();
+
+            for (unsigned int a = 0; a != active_count; ++a) {
+                const unsigned int input = active[a];
+                vec_type sig;
+                sig.load_aligned(in[input] + i);
+
+                for (unsigned int k = 0; k != tile; ++k) {
+                    const unsigned int index = (first_output + k) * inputs_ + input;
+                    vec_type g;
+                    g.load_aligned(vector_gains.data() + index * vec_size);
+                    if (ramped) {
+                        vec_type step;
+                        step.load_aligned(vector_slopes.data() + index * vec_size);
+                        g += step * steps;
+                    }
+                    sum[k] += sig * g;
+                }
+            }
+
+            for (unsigned int k = 0; k != tile; ++k)
+                sum[k].store_aligned(out[k] + i);
+        }
+    }
+
+    void finish_block(void)
+    {
+        if (!ramping_)
+            return;
+        reset();
+    }
+
+    void set_current(unsigned int index, F value)
+    {
+        current[index] = value;
+        for (unsigned int lane = 0; lane != vec_size; ++lane)
+            vector_gains[index * vec_size + lane] = value;
+    }
+
+    const unsigned int inputs_, outputs_;
+    detail::aligned_buffer<F> current;
+    detail::aligned_buffer<F> targets;
+    detail::aligned_buffer<F> vector_gains;     /* current gains, repeated for each lane */
+    detail::aligned_buffer<F> vector_slopes;    /* gain increments per vector of ramping crosspoints */
+    std::vector<unsigned int> active;
+    bool ramping_;
+};
+
+} /* namespace nova */
+
+#endif /* SIMD_MATRIX_MIXER_HPP */
@@ -22,6 +22,7 @@
 
 #include "vec.hpp"
 #include "detail/define_macros.hpp"
+#include "detail/math.hpp"
 #include "detail/wrap_argument_vector.hpp"
 
 namespace nova
@@ -65,6 +66,55 @@ struct sum
     }
 };
 
+template <typename FloatType>
+always_inline FloatType clip_crossfade(FloatType position)
+{
+    return max_(FloatType(0.0), min_(position, FloatType(1.0)));
+}
+
+/* crossfades from sig0 (position 0) to sig1 (position 1) */
+struct crossfade_linear
+{
+    template<typename ArgType>
+    always_inline ArgType operator()(ArgType sig0, ArgType sig1, ArgType position) const
+    {
+        return sig0 + (sig1 - sig0) * clip_crossfade(position);
+    }
+};
+
+struct crossfade_equal_power
+{
+    template<typename ArgType>
+    always_inline ArgType operator()(ArgType sig0, ArgType sig1, ArgType position) const
+    {
+        const double pi = 3.14159265358979323846264338327950288419716939937510;
+        const ArgType angle = clip_crossfade(position) * ArgType(0.5 * pi);
+        return sig0 * cos(angle) + sig1 * sin(angle);
+    }
+};
+
+struct crossfade_sqrt
+{
+    template<typename ArgType>
+    always_inline ArgType operator()(ArgType sig0, ArgType sig1, ArgType position) const
+    {
+        const ArgType x = clip_crossfade(position);
+        return sig0 * sqrt(ArgType(1.0) - x) + sig1 * sqrt(x);
+    }
+};
+
+/* smoothstep: 3x^2 - 2x^3 */
+struct crossfade_s_curve
+{
+    template<typename ArgType>
+    always_inline ArgType operator()(ArgType sig0, ArgType sig1, ArgType position) const
+    {
+        const ArgType x = clip_crossfade(position);
+        const ArgType s = x * x * (ArgType(3.0) - ArgType(2.0) * x);
+        return sig0 + (sig1 - sig0) * s;
+    }
+};
+
 }
 
 NOVA_SIMD_DEFINE_4ARY_WRAPPER(mix, detail::scaled_mix2)
@@ -73,6 +123,73 @@ NOVA_SIMD_DEFINE_BINARY_WRAPPER(sum, detail::sum)
 NOVA_SIMD_DEFINE_TERNARY_WRAPPER(sum, detail::sum)
 NOVA_SIMD_DEFINE_4ARY_WRAPPER(sum, detail::sum)
 
+NOVA_SIMD_DEFINE_TERNARY_WRAPPER(crossfade_linear, detail::crossfade_linear)
+NOVA_SIMD_DEFINE_TERNARY_WRAPPER(crossfade_equal_power, detail::crossfade_equal_power)
+NOVA_SIMD_DEFINE_TERNARY_WRAPPER(crossfade_sqrt, detail::crossfade_sqrt)
+NOVA_SIMD_DEFINE_TERNARY_WRAPPER(crossfade_s_curve, detail::crossfade_s_curve)
+
+enum crossfade_curve
+{
+    linear_crossfade,
+    equal_power_crossfade,
+    sqrt_crossfade,
+    s_curve_crossfade
+};
+
+/* @{ */
+/** crossfade from sig0 to sig1, position is clipped to [0, 1]. out may alias sig0 or sig1 */
+template <typename FloatType, typename Arg1, typename Arg2, typename Arg3>
+inline void crossfade_vec(FloatType * out, Arg1 sig0, Arg2 sig1, Arg3 position, crossfade_curve curve, unsigned int n)
+{
+    switch (curve) {
+    case equal_power_crossfade:
+        crossfade_equal_power_vec(out, sig0, sig1, position, n);
+        break;
+    case sqrt_crossfade:
+        crossfade_sqrt_vec(out, sig0, sig1, position, n);
+        break;
+    case s_curve_crossfade:
+        crossfade_s_curve_vec(out, sig0, sig1, position, n);
+        break;
+    default:
+        crossfade_linear_vec(out, sig0, sig1, position, n);
+    }
+}
+
+template <typename FloatType, typename Arg1, typename Arg2, typename Arg3>
+inline void crossfade_vec_simd(FloatType * out, Arg1 sig0, Arg2 sig1, Arg3 position, crossfade_curve curve, unsigned int n)
+{
+    switch (curve) {
+    case equal_power_crossfade:
+        crossfade_equal_power_vec_simd(out, sig0, sig1, position, n);
+        break;
+    case sqrt_crossfade:
+        crossfade_sqrt_vec_simd(out, sig0, sig1, position, n);
+        break;
+    case s_curve_crossfade:
+        crossfade_s_curve_vec_simd(out, sig0, sig1, position, n);
+        break;
+    default:
+        crossfade_linear_vec_simd(out, sig0, sig1, position, n);
+    }
+}
+/* @} */
+
+/* @{ */
+/** in-place wet/dry mix: replaces the dry signal in inout with the crossfade to wet at mix */
+template <typename FloatType, typename WetArg, typename MixArg>
+inline void wet_dry_vec(FloatType * inout, WetArg wet, MixArg mix, crossfade_curve curve, unsigned int n)
+{
+    crossfade_vec(inout, (const FloatType*)inout, wet, mix, curve, n);
+}
+
+template <typename FloatType, typename WetArg, typename MixArg>
+inline void wet_dry_vec_simd(FloatType * inout, WetArg wet, MixArg mix, crossfade_curve curve, unsigned int n)
+{
+    crossfade_vec_simd(inout, (const FloatType*)inout, wet, mix, curve, n);
+}
+/* @} */
+
 }
 
 #undef always_inline
@@ -0,0 +1,323 @@
+//  simd noise generators
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef SIMD_NOISE_HPP
+#define SIMD_NOISE_HPP
+
+#include <cassert>
+
+#include <stdint.h>
+
+#include "vec.hpp"
+#include "detail/aligned_buffer.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+namespace nova {
+namespace detail {
+
+always_inline uint32_t xorshift32(uint32_t x)
+{
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return x;
+}
+
+/* decorrelate consecutive seeds */
+inline uint32_t hash_seed(uint32_t x)
+{
+    x ^= x >> 16;
+    x *= 0x85ebca6bu;
+    x ^= x >> 13;
+    x *= 0xc2b2ae35u;
+    x ^= x >> 16;
+    return x ? x : 1;
+}
+
+/* map random bits to [-1, 1) by filling the mantissa of a number in [1, 2) */
+template <typename F>
+always_inline F bits_to_bipolar(uint32_t bits);
+
+template <>
+always_inline float bits_to_bipolar<float>(uint32_t bits)
+{
+    union {
+        uint32_t i;
+        float f;
+    } u;
+    u.i = (bits >> 9) | 0x3f800000u;
+    return u.f * 2.f - 3.f;
+}
+
+template <>
+always_inline double bits_to_bipolar<double>(uint32_t bits)
+{
+    union {
+        uint64_t i;
+        double f;
+    } u;
+    u.i = (uint64_t(bits) << 20) | 0x3ff0000000000000ull;
+    return u.f * 2.0 - 3.0;
+}
+
+inline unsigned int count_trailing_zeros(uint32_t x)
+{
+#ifdef __GNUC__
+    return __builtin_ctz(x);
+#else
+    unsigned int ret = 0;
+    while (!(x & 1)) {
+        x >>= 1;
+        ++ret;
+    }
+    return ret;
+#endif
+}
+
+/* advance all lanes of the generator and write one sample per lane */
+template <typename F, bool Vectorize = has_int_vec<vec<float> >::value>
+struct xorshift_lanes
+{
+    static const unsigned int lanes = vec<float>::size;
+
+    static always_inline void generate(uint32_t * state, F * out)
+    {
+        for (unsigned int lane = 0; lane != lanes; ++lane) {
+            state[lane] = xorshift32(state[lane]);
+            out[lane] = bits_to_bipolar<F>(state[lane]);
+        }
+    }
+};
+
+template <>
+struct xorshift_lanes<float, true>
+{
+    typedef vec<float> vec_type;
+    typedef vec_type::int_vec int_vec;
+    static const unsigned int lanes = vec_type::size;
+
+    static always_inline void generate(uint32_t * state, float * out)
+    {
+        vec_type bits;
+        bits.load_aligned(reinterpret_cast<float*>(state));
+
+        int_vec x(bits);
+        x = x ^ slli(x, 13);
+        x = x ^ srli(x, 17);
+        x = x ^ slli(x, 5);
+        vec_type(x).store_aligned(reinterpret_cast<float*>(state));
+
+        const vec_type one_to_two(srli(x, 9) | int_vec(0x3f800000));
+        const vec_type result = one_to_two * vec_type(2.f) - vec_type(3.f);
+        result.store_aligned(out);
+    }
+};
+
+}
+
+/* noise generators
+ *
+ * the generator keeps one xorshift state per lane of vec<float>, so vectors of random numbers are
+ * computed in parallel on the integer units, and converted to floating point by filling the mantissa
+ * bits. consecutive output samples are taken from consecutive lanes.
+ *
+ * white: uniform noise in [-1, 1)
+ * pink:  voss-mccartney pink noise (-3 dB per octave), roughly in [-1, 1)
+ * brown: leaky integrated white noise (-6 dB per octave)
+ * dust:  random impulses with amplitudes in [0, 1), density is the probability of an impulse per sample
+ *
+ * the scalar and _simd versions generate the same sequence. the _simd versions require n to be a
+ * multiple of noise_generator<F>::lanes, out to be aligned and the generator to be at a lane
+ * boundary, i.e. all previous calls of the scalar versions must have generated multiples of lanes
+ * samples.
+ */
+template <typename F>
+class noise_generator
+{
+    typedef vec<F> vec_type;
+    typedef detail::xorshift_lanes<F> generator;
+
+    static const unsigned int pink_rows = 16;
+
+public:
+    static const unsigned int lanes = generator::lanes;
+
+    explicit noise_generator(uint32_t seed_value = 1):
+        state(lanes)
+    {
+        seed(seed_value);
+    }
+
+    void seed(uint32_t seed_value)
+    {
+        for (unsigned int lane = 0; lane != lanes; ++lane)
+            state[lane] = detail::hash_seed(seed_value + lane * 0x9e3779b9u);
+        lane_position = 0;
+
+        row_state = detail::hash_seed(seed_value ^ 0x5bd1e995u);
+        for (unsigned int row = 0; row != pink_rows; ++row)
+            rows[row] = F(0);
+        row_sum = F(0);
+        row_counter = 0;
+
+        brown_state = F(0);
+    }
+
+    /* @{ */
+    /** white noise */
+    void white(F * out, unsigned int n)
+    {
+        for (unsigned int i = 0; i != n; ++i) {
+            uint32_t & lane_state = state[lane_position];
+            lane_state = detail::xorshift32(lane_state);
+            out[i] = detail::bits_to_bipolar<F>(lane_state);
+            lane_position = (lane_position + 1) % lanes;
+        }
+    }
+
+    void white_simd(F * out, unsigned int n)
+    {
+        assert(lane_position == 0);
+        assert(n % lanes == 0);
+        for (unsigned int i = 0; i != n; i += lanes)
+            generator::generate(state.data(), out + i);
+    }
+    /* @} */
+
+    /* @{ */
+    /** pink noise */
+    void pink(F * out, unsigned int n)
+    {
+        white(out, n);
+        pink_filter(out, n);
+    }
+
+    void pink_simd(F * out, unsigned int n)
+    {
+        white_simd(out, n);
+        pink_filter(out, n);
+    }
+    /* @} */
+
+    /* @{ */
+    /** brown noise */
+    void brown(F * out, unsigned int n)
+    {
+        white(out, n);
+        brown_filter(out, n);
+    }
+
+    void brown_simd(F * out, unsigned int n)
+    {
+        white_simd(out, n);
+        brown_filter(out, n);
+    }
+    /* @} */
+
+    /* @{ */
+    /** random impulses */
+    void dust(F * out, F density, unsigned int n)
+    {
+        white(out, n);
+        const F scale = F(0.5) / density;
+        for (unsigned int i = 0; i != n; ++i) {
+            const F uniform = (out[i] + F(1)) * F(0.5);
+            out[i] = uniform < density ? (out[i] + F(1)) * scale : F(0);
+        }
+    }
+
+    void dust_simd(F * out, F density, unsigned int n)
+    {
+        white_simd(out, n);
+        const vec_type one(F(1));
+        const vec_type half(F(0.5));
+        const vec_type vdensity(density);
+        const vec_type scale(F(0.5) / density);
+        vec_type zero;
+        zero.clear();
+
+        for (unsigned int i = 0; i != n; i += vec_type::size) {
+            vec_type noise;
+            noise.load_aligned(out + i);
+            const vec_type shifted = noise + one;
+            const vec_type uniform = shifted * half;
+            const vec_type result = select(zero, shifted * scale, mask_lt(uniform, vdensity));
+            result.store_aligned(out + i);
+        }
+    }
+    /* @} */
+
+private:
+    /* row k of the voss-mccartney generator is updated every 2^(k+1) samples. the rows are driven by
+     * a separate scalar generator, the white noise of the block is added as the top octave */
+    void pink_filter(F * out, unsigned int n)
+    {
+        const F scale = F(1) / F(pink_rows + 1);
+        F sum = row_sum;
+        for (unsigned int i = 0; i != n; ++i) {
+            ++row_counter;
+            const unsigned int row = detail::count_trailing_zeros(row_counter | (1u << (pink_rows - 1)));
+
+            row_state = detail::xorshift32(row_state);
+            const F value = detail::bits_to_bipolar<F>(row_state);
+            sum += value - rows[row];
+            rows[row] = value;
+
+            out[i] = (sum + out[i]) * scale;
+
+            /* avoid the accumulation of rounding errors */
+            if ((row_counter & 0xffff) == 0) {
+                sum = F(0);
+                for (unsigned int k = 0; k != pink_rows; ++k)
+                    sum += rows[k];
+            }
+        }
+        row_sum = sum;
+    }
+
+    void brown_filter(F * out, unsigned int n)
+    {
+        F y = brown_state;
+        for (unsigned int i = 0; i != n; ++i) {
+            y = (y + F(0.02) * out[i]) * F(1 / 1.02);
+            out[i] = y * F(3.5);
+        }
+        brown_state = y;
+    }
+
+    detail::aligned_buffer<uint32_t> state;
+    unsigned int lane_position;
+
+    uint32_t row_state;
+    F rows[pink_rows];
+    F row_sum;
+    uint32_t row_counter;
+
+    F brown_state;
+};
+
+} /* namespace nova */
+
+#undef always_inline
+
+#endif /* SIMD_NOISE_HPP */
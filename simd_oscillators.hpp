@@ -0,0 +1,540 @@
+//  simd band-limited oscillators
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef SIMD_OSCILLATORS_HPP
+#define SIMD_OSCILLATORS_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "vec.hpp"
+#include "detail/wrap_argument_vector.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+/* band-limited classic waveforms, using 2-point polynomial approximations of the band-limited step
+ * (polyblep) and ramp (polyblamp) residuals.
+ *
+ * saw_vec(out, phase, increment, n):                sawtooth, rising from -1 to 1
+ * pulse_vec(out, phase, increment, width, n):       pulse, 1 for phase < width, -1 otherwise
+ * triangle_vec(out, phase, increment, n):           triangle, -1 at phase 0, 1 at phase 0.5
+ * saw_sync_vec(out, state, increment, master_increment, n):
+ *                                                   sawtooth, hard-synced to a master oscillator
+ *
+ * phases are in cycles ([0, 1)) and are updated in place, increments are in cycles per sample and
+ * must be in the range [0, 0.5). increments and widths can be scalars, vectors or slope arguments.
+ * for the _simd versions n must be a multiple of vec<F>::size and vector arguments must be aligned.
+ *
+ * for scalar and slope increments the _simd versions compute the phases of each vector in registers.
+ * for per-sample increments and for hard sync the phases are accumulated sequentially. the waveforms
+ * and their corrections are computed branchlessly on full vectors.
+ */
+
+namespace nova {
+namespace detail {
+
+/* residual of the band-limited step of height 2 at phase 0 */
+struct polyblep
+{
+    template <typename F>
+    always_inline F operator()(F t, F dt) const
+    {
+        if (t < dt) {
+            const F x = t / dt;
+            return x + x - x * x - F(1);
+        }
+        if (t > F(1) - dt) {
+            const F x = (t - F(1)) / dt;
+            return x * x + x + x + F(1);
+        }
+        return F(0);
+    }
+
+    template <typename F>
+    always_inline vec<F> operator()(vec<F> const & t, vec<F> const & dt) const
+    {
+        const vec<F> one(F(1));
+        const vec<F> x0 = t / dt;
+        const vec<F> x1 = (t - one) / dt;
+
+        const vec<F> after  = x0 + x0 - x0 * x0 - one;
+        const vec<F> before = x1 * x1 + x1 + x1 + one;
+
+        vec<F> zero;
+        zero.clear();
+        vec<F> ret = select(zero, after, mask_lt(t, dt));
+        return select(ret, before, mask_gt(t, one - dt));
+    }
+};
+
+/* residual of the band-limited ramp with a slope change of 2 per sample at phase 0 */
+struct polyblamp
+{
+    template <typename F>
+    always_inline F operator()(F t, F dt) const
+    {
+        if (t < dt) {
+            const F x = t / dt;
+            return F(1)/F(3) - x + x * x - x * x * x * F(1)/F(3);
+        }
+        if (t > F(1) - dt) {
+            const F x = (t - F(1)) / dt + F(1);
+            return x * x * x * F(1)/F(3);
+        }
+        return F(0);
+    }
+
+    template <typename F>
+    always_inline vec<F> operator()(vec<F> const & t, vec<F> const & dt) const
+    {
+        const vec<F> one(F(1));
+        const vec<F> third(F(1)/F(3));
+        const vec<F> x0 = t / dt;
+        const vec<F> x1 = (t - one) / dt + one;
+
+        const vec<F> after  = third - x0 + x0 * x0 - x0 * x0 * x0 * third;
+        const vec<F> before = x1 * x1 * x1 * third;
+
+        vec<F> zero;
+        zero.clear();
+        vec<F> ret = select(zero, after, mask_lt(t, dt));
+        return select(ret, before, mask_gt(t, one - dt));
+    }
+};
+
+/* phase + offset, wrapped into [0, 1) for offsets in [0, 1) */
+template <typename F>
+always_inline F wrap_phase(F phase)
+{
+    return phase >= F(1) ? phase - F(1) : phase;
+}
+
+template <typename F>
+always_inline vec<F> wrap_phase(vec<F> const & phase)
+{
+    const vec<F> one(F(1));
+    return select(phase, phase - one, mask_ge(phase, one));
+}
+
+template <typename F>
+always_inline F pulse_naive(F t, F width)
+{
+    return t < width ? F(1) : F(-1);
+}
+
+template <typename F>
+always_inline vec<F> pulse_naive(vec<F> const & t, vec<F> const & width)
+{
+    return select(vec<F>(F(-1)), vec<F>(F(1)), mask_lt(t, width));
+}
+
+struct saw_functor
+{
+    template <typename F>
+    always_inline vec<F> operator()(vec<F> const & t, vec<F> const & dt) const
+    {
+        return vec<F>(F(2)) * t - vec<F>(F(1)) - polyblep()(t, dt);
+    }
+
+    template <typename F>
+    always_inline F operator()(F t, F dt) const
+    {
+        return F(2) * t - F(1) - polyblep()(t, dt);
+    }
+};
+
+struct pulse_functor
+{
+    template <typename T, typename F>
+    always_inline T impl(T const & t, T const & dt, T const & width) const
+    {
+        const T falling = wrap_phase(t + (T(F(1)) - width));
+        return pulse_naive(t, width) + polyblep()(t, dt) - polyblep()(falling, dt);
+    }
+
+    template <typename F>
+    always_inline vec<F> operator()(vec<F> const & t, vec<F> const & dt, vec<F> const & width) const
+    {
+        return impl<vec<F>, F>(t, dt, width);
+    }
+
+    template <typename F>
+    always_inline F operator()(F t, F dt, F width) const
+    {
+        return impl<F, F>(t, dt, width);
+    }
+};
+
+struct triangle_functor
+{
+    template <typename T, typename F>
+    always_inline T impl(T const & t, T const & dt) const
+    {
+        using std::abs;
+
+        /* the slope changes by 8 per cycle at both corners */
+        const T peak = wrap_phase(t + T(F(0.5)));
+        const T naive = T(F(1)) - T(F(4)) * abs(t - T(F(0.5)));
+        return naive + T(F(4)) * dt * (polyblamp()(t, dt) - polyblamp()(peak, dt));
+    }
+
+    template <typename F>
+    always_inline vec<F> operator()(vec<F> const & t, vec<F> const & dt) const
+    {
+        return impl<vec<F>, F>(t, dt);
+    }
+
+    template <typename F>
+    always_inline F operator()(F t, F dt) const
+    {
+        return impl<F, F>(t, dt);
+    }
+};
+
+/* write the phase of each sample to out */
+template <typename F, typename Arg>
+always_inline void generate_phases(F * out, F * phase, Arg increment, unsigned int n)
+{
+    F p = *phase;
+    for (unsigned int i = 0; i != n; ++i) {
+        out[i] = p;
+        p = wrap_phase(p + increment.consume());
+    }
+    *phase = p;
+}
+
+template <typename F, typename Functor, typename Arg>
+always_inline void oscillator_vec(F * out, F * phase, Arg increment, unsigned int n, Functor const & f)
+{
+    generate_phases(out, phase, increment, n);
+    for (unsigned int i = 0; i != n; ++i)
+        out[i] = f(out[i], increment.consume());
+}
+
+/* phases of consecutive vectors of samples. per-sample increments are accumulated sequentially and
+ * the phases are stored to out, which is read back by consume() */
+template <typename F, typename Arg>
+struct vector_phases
+{
+    always_inline vector_phases(F * out, F * phase, Arg increment, unsigned int n):
+        data(out)
+    {
+        generate_phases(out, phase, increment, n);
+    }
+
+    always_inline vec<F> consume(void)
+    {
+        vec<F> ret;
+        ret.load_aligned(data);
+        data += vec<F>::size;
+        return ret;
+    }
+
+    always_inline void finish(void)
+    {}
+
+    const F * data;
+};
+
+/* constant increments: the lanes start at phase + lane * increment and advance by
+ * vec<F>::size * increment. the advance is reduced to [0, 1) in advance, so the phases only need a
+ * single wrap per vector */
+template <typename F>
+struct vector_phases<F, scalar_scalar_argument<F> >
+{
+    typedef vec<F> vec_type;
+
+    always_inline vector_phases(F *, F * phase, scalar_scalar_argument<F> increment, unsigned int):
+        phase_(phase), step(frac(F(vec_type::size) * increment.data))
+    {
+        vec_type lane;
+        lane.set_slope(F(0), F(1));
+        phases = frac(vec_type(*phase) + lane * vec_type(increment.data));
+    }
+
+    always_inline vec_type consume(void)
+    {
+        const vec_type ret = phases;
+        phases = wrap_phase(phases + step);
+        return ret;
+    }
+
+    always_inline void finish(void)
+    {
+        *phase_ = phases.get(0);
+    }
+
+    F * phase_;
+    const vec_type step;
+    vec_type phases;
+};
+
+/* linear increments: lane l starts at phase + l * increment + slope * l * (l - 1) / 2. every lane
+ * advances by the sum of the next vec<F>::size increments of its sample, which grows by
+ * vec<F>::size^2 * slope per vector. phases and advances are kept in [0, 1), so both only need a
+ * single wrap per vector */
+template <typename F>
+struct vector_phases<F, scalar_ramp_argument<F> >
+{
+    typedef vec<F> vec_type;
+
+    always_inline vector_phases(F *, F * phase, scalar_ramp_argument<F> increment, unsigned int):
+        phase_(phase), advance_step(frac(F(vec_type::size * vec_type::size) * increment.slope_))
+    {
+        const F size = F(vec_type::size);
+        const vec_type slope(increment.slope_);
+        vec_type lane;
+        lane.set_slope(F(0), F(1));
+
+        const vec_type increments = vec_type(increment.data) + lane * slope;
+        advance = frac(vec_type(size) * increments + vec_type(increment.slope_ * size * (size - F(1)) * F(0.5)));
+        phases = frac(vec_type(*phase) + lane * vec_type(increment.data)
+                      + lane * (lane - vec_type(F(1))) * vec_type(F(0.5)) * slope);
+    }
+
+    always_inline vec_type consume(void)
+    {
+        const vec_type ret = phases;
+        phases = wrap_phase(phases + advance);
+        advance = wrap_phase(advance + advance_step);
+        return ret;
+    }
+
+    always_inline void finish(void)
+    {
+        *phase_ = phases.get(0);
+    }
+
+    F * phase_;
+    const vec_type advance_step;
+    vec_type advance;
+    vec_type phases;
+};
+
+template <typename F, typename Functor, typename Phases, typename Arg>
+always_inline void apply_on_phases_simd(F * out, Phases phases, Arg increment, unsigned int n, Functor const & f)
+{
+    for (unsigned int i = 0; i != n; i += vec<F>::size)
+        f(phases.consume(), increment.consume()).store_aligned(out + i);
+    phases.finish();
+}
+
+template <typename F, typename Functor, typename Arg>
+always_inline void oscillator_vec_simd(F * out, F * phase, Arg increment, unsigned int n, Functor const & f)
+{
+    vector_phases<F, Arg> phases(out, phase, increment, n);
+    apply_on_phases_simd(out, phases, wrap_vector_arg(increment), n, f);
+}
+
+template <typename F, typename Arg1, typename Arg2>
+always_inline void pulse_oscillator_vec(F * out, F * phase, Arg1 increment, Arg2 width, unsigned int n)
+{
+    generate_phases(out, phase, increment, n);
+    for (unsigned int i = 0; i != n; ++i)
+        out[i] = pulse_functor()(out[i], increment.consume(), width.consume());
+}
+
+template <typename F, typename Phases, typename Arg1, typename Arg2>
+always_inline void pulse_on_phases_simd(F * out, Phases phases, Arg1 increment, Arg2 width, unsigned int n)
+{
+    for (unsigned int i = 0; i != n; i += vec<F>::size)
+        pulse_functor()(phases.consume(), increment.consume(), width.consume()).store_aligned(out + i);
+    phases.finish();
+}
+
+template <typename F, typename Arg1, typename Arg2>
+always_inline void pulse_oscillator_vec_simd(F * out, F * phase, Arg1 increment, Arg2 width, unsigned int n)
+{
+    vector_phases<F, Arg1> phases(out, phase, increment, n);
+    pulse_on_phases_simd(out, phases, wrap_vector_arg(increment), wrap_vector_arg(width), n);
+}
+
+} /* namespace detail */
+
+template <typename F, typename IncrementArg>
+inline void saw_vec(F * out, F * phase, IncrementArg increment, unsigned int n)
+{
+    detail::oscillator_vec(out, phase, wrap_argument(increment), n, detail::saw_functor());
+}
+
+template <typename F, typename IncrementArg>
+inline void saw_vec_simd(F * out, F * phase, IncrementArg increment, unsigned int n)
+{
+    detail::oscillator_vec_simd(out, phase, wrap_argument(increment), n, detail::saw_functor());
+}
+
+template <typename F, typename IncrementArg>
+inline void triangle_vec(F * out, F * phase, IncrementArg increment, unsigned int n)
+{
+    detail::oscillator_vec(out, phase, wrap_argument(increment), n, detail::triangle_functor());
+}
+
+template <typename F, typename IncrementArg>
+inline void triangle_vec_simd(F * out, F * phase, IncrementArg increment, unsigned int n)
+{
+    detail::oscillator_vec_simd(out, phase, wrap_argument(increment), n, detail::triangle_functor());
+}
+
+template <typename F, typename IncrementArg, typename WidthArg>
+inline void pulse_vec(F * out, F * phase, IncrementArg increment, WidthArg width, unsigned int n)
+{
+    detail::pulse_oscillator_vec(out, phase, wrap_argument(increment), wrap_argument(width), n);
+}
+
+template <typename F, typename IncrementArg, typename WidthArg>
+inline void pulse_vec_simd(F * out, F * phase, IncrementArg increment, WidthArg width, unsigned int n)
+{
+    detail::pulse_oscillator_vec_simd(out, phase, wrap_argument(increment), wrap_argument(width), n);
+}
+
+/* state of a hard-synced oscillator: the phases of the slave and the master oscillator and the
+ * correction of the first sample after a reset, which may fall into the next block */
+template <typename F>
+struct hard_sync_state
+{
+    hard_sync_state(void):
+        phase(0), master_phase(0), pending_correction(0)
+    {}
+
+    F phase;
+    F master_phase;
+    F pending_correction;
+};
+
+namespace detail {
+
+/* compute phases and the sync corrections, which are not covered by the polyblep of saw_functor.
+ * the slave phase is reset to the fraction of the sample after the master phase wraps. */
+template <typename F, typename Arg1, typename Arg2>
+always_inline void generate_sync_phases(F * phases, F * corrections, hard_sync_state<F> & state,
+                                        Arg1 & increment, Arg2 & master_increment, unsigned int n)
+{
+    F p = state.phase;
+    F master = state.master_phase;
+    F pending = state.pending_correction;
+
+    for (unsigned int i = 0; i != n; ++i) {
+        const F dt = increment.consume();
+        const F master_dt = master_increment.consume();
+        phases[i] = p;
+        corrections[i] = pending;
+        pending = F(0);
+
+        const F next_master = master + master_dt;
+        if (next_master < F(1)) {
+            master = next_master;
+            p = wrap_phase(p + dt);
+            continue;
+        }
+
+        /* reset at fraction f between this and the next sample */
+        const F f = (F(1) - master) / master_dt;
+        F phase_at_reset = p + f * dt;
+        const bool wrapped = phase_at_reset >= F(1);
+        if (wrapped)
+            phase_at_reset -= F(1);
+
+        /* the saw jumps by -2 * phase_at_reset. if the slave wrapped just before, the polyblep of
+         * saw_functor already applies the full step after the reset */
+        const F x = F(1) - f;
+        corrections[i] -= phase_at_reset * (F(1) - f) * (F(1) - f);
+        if (!wrapped && p > F(1) - dt)
+            corrections[i] += polyblep()(p, dt); /* the slave does not wrap */
+        pending = ((wrapped ? F(0) : F(1)) - phase_at_reset) * (x + x - x * x - F(1));
+
+        master = next_master - F(1);
+        p = x * dt;
+    }
+
+    state.phase = p;
+    state.master_phase = master;
+    state.pending_correction = pending;
+}
+
+const unsigned int sync_chunk_size = 64;
+
+template <typename F, typename Arg1, typename Arg2>
+always_inline void saw_sync_oscillator_vec(F * out, hard_sync_state<F> & state, Arg1 increment, Arg2 master_increment,
+                                           unsigned int n)
+{
+    Arg1 blep_increment = increment;
+
+    F corrections[sync_chunk_size];
+    while (n) {
+        const unsigned int chunk = std::min(n, sync_chunk_size);
+        generate_sync_phases(out, corrections, state, increment, master_increment, chunk);
+
+        for (unsigned int i = 0; i != chunk; ++i)
+            out[i] = saw_functor()(out[i], blep_increment.consume()) + corrections[i];
+
+        out += chunk;
+        n -= chunk;
+    }
+}
+
+template <typename F, typename Arg1, typename Arg2, typename VectorArg>
+always_inline void saw_sync_oscillator_vec_simd(F * out, hard_sync_state<F> & state, Arg1 increment, Arg2 master_increment,
+                                                VectorArg blep_increment, unsigned int n)
+{
+    typedef vec<F> vec_type;
+
+    F corrections[sync_chunk_size];
+    while (n) {
+        const unsigned int chunk = std::min(n, sync_chunk_size);
+        generate_sync_phases(out, corrections, state, increment, master_increment, chunk);
+
+        for (unsigned int i = 0; i != chunk; i += vec_type::size) {
+            vec_type t, correction;
+            t.load_aligned(out + i);
+            correction.load(corrections + i);
+            vec_type result = saw_functor()(t, blep_increment.consume()) + correction;
+            result.store_aligned(out + i);
+        }
+
+        out += chunk;
+        n -= chunk;
+    }
+}
+
+}
+
+template <typename F, typename IncrementArg, typename MasterIncrementArg>
+inline void saw_sync_vec(F * out, hard_sync_state<F> & state, IncrementArg increment,
+                         MasterIncrementArg master_increment, unsigned int n)
+{
+    detail::saw_sync_oscillator_vec(out, state, wrap_argument(increment), wrap_argument(master_increment), n);
+}
+
+template <typename F, typename IncrementArg, typename MasterIncrementArg>
+inline void saw_sync_vec_simd(F * out, hard_sync_state<F> & state, IncrementArg increment,
+                              MasterIncrementArg master_increment, unsigned int n)
+{
+    detail::saw_sync_oscillator_vec_simd(out, state, wrap_argument(increment), wrap_argument(master_increment),
+                                         detail::wrap_vector_arg(wrap_argument(increment)), n);
+}
+
+} /* namespace nova */
+
+#undef always_inline
+
+#endif /* SIMD_OSCILLATORS_HPP */
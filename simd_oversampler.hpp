@@ -0,0 +1,410 @@
+//  simd oversampling for nonlinear functions
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef SIMD_OVERSAMPLER_HPP
+#define SIMD_OVERSAMPLER_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "vec.hpp"
+#include "simd_window.hpp"
+#include "detail/aligned_buffer.hpp"
+#include "detail/interleave_network.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+namespace nova {
+namespace detail {
+
+/* one 2x stage of the oversampler
+ *
+ * the half-band filter h has 4 * half_taps - 1 taps, h[0] = 0.5 and all other even taps are zero. the
+ * 2 * half_taps odd taps are stored in coefficients. with polyphase decomposition, upsampling copies
+ * the delayed input to the even outputs and filters the odd outputs, downsampling adds the delayed
+ * even inputs to the filtered odd inputs. both directions delay the signal by half_taps samples of
+ * the lower rate.
+ */
+template <typename F>
+class halfband_stage
+{
+    typedef vec<F> vec_type;
+
+    halfband_stage(halfband_stage const &);
+    halfband_stage & operator=(halfband_stage const &);
+
+public:
+    /* max_size: maximum block size at the lower rate */
+    halfband_stage(unsigned int half_taps, double beta, unsigned int max_size):
+        half_taps(half_taps), taps(2 * half_taps), max_size(max_size),
+        coefficients(2 * half_taps), up_history(2 * half_taps - 1 + max_size),
+        even_history(half_taps + max_size), odd_history(2 * half_taps + max_size)
+    {
+        const double pi = 3.14159265358979323846264338327950288419716939937510;
+        const unsigned int length = 4 * half_taps - 1;
+        std::vector<double> window(length);
+        make_window(&window.front(), kaiser_window, length, beta, false);
+
+        /* coefficient i is the half-band tap 2 * i - taps + 1 */
+        double sum = 0;
+        std::vector<double> values(taps);
+        for (unsigned int i = 0; i != taps; ++i) {
+            const int tap = 2 * int(i) - int(taps) + 1;
+            const double arg = 0.5 * pi * tap;
+            values[i] = 0.5 * std::sin(arg) / arg * window[tap + taps - 1];
+            sum += values[i];
+        }
+
+        /* the odd taps sum up to 0.5 for unity gain at dc */
+        for (unsigned int i = 0; i != taps; ++i)
+            coefficients[i] = F(0.5 * values[i] / sum);
+
+        reset();
+    }
+
+    void reset(void)
+    {
+        up_history.clear();
+        even_history.clear();
+        odd_history.clear();
+    }
+
+    /* the previous stage writes the input of upsample to this buffer */
+    F * upsample_input(void)
+    {
+        return up_history.data() + taps - 1;
+    }
+
+    /* upsample n samples from upsample_input() to 2 * n samples */
+    template <bool simd>
+    void upsample(F * out, unsigned int n)
+    {
+        assert(n <= max_size);
+        const F * in = upsample_input();
+
+        if (simd)
+            upsample_simd(out, in, n);
+        else {
+            for (unsigned int j = 0; j != n; ++j) {
+                out[2*j]   = in[int(j) - int(half_taps)];
+                out[2*j+1] = F(2) * filter(in + j);
+            }
+        }
+
+        std::memmove(up_history.data(), up_history.data() + n, (taps - 1) * sizeof(F));
+    }
+
+    /* downsample 2 * n samples to n samples. in and out may be the same buffer */
+    template <bool simd>
+    void downsample(F * out, const F * in, unsigned int n)
+    {
+        assert(n <= max_size);
+        F * even = even_history.data() + half_taps;
+        F * odd  = odd_history.data() + taps;
+
+        for (unsigned int j = 0; j != n; ++j) {
+            even[j] = in[2*j];
+            odd[j]  = in[2*j+1];
+        }
+
+        if (simd)
+            downsample_simd(out, even, odd, n);
+        else {
+            for (unsigned int j = 0; j != n; ++j)
+                out[j] = F(0.5) * even[int(j) - int(half_taps)] + filter(odd + j - 1);
+        }
+
+        std::memmove(even_history.data(), even_history.data() + n, half_taps * sizeof(F));
+        std::memmove(odd_history.data(), odd_history.data() + n, taps * sizeof(F));
+    }
+
+private:
+    /* sum of coefficients[i] * in[-i], using the symmetry of the coefficients */
+    always_inline F filter(const F * in) const
+    {
+        F sum = 0;
+        for (unsigned int i = 0; i != half_taps; ++i)
+            sum += coefficients[i] * (in[-int(i)] + in[int(i) + 1 - int(taps)]);
+        return sum;
+    }
+
+    always_inline vec_type filter_simd(const F * in) const
+    {
+        vec_type sum;
+        sum.clear();
+        for (unsigned int i = 0; i != half_taps; ++i) {
+            vec_type newer, older;
+            newer.load(in - int(i));
+            older.load(in + int(i) + 1 - int(taps));
+            sum += vec_type(coefficients[i]) * (newer + older);
+        }
+        return sum;
+    }
+
+    void upsample_simd(F * out, const F * in, unsigned int n) const
+    {
+        const unsigned int vec_size = vec_type::size;
+        assert(n % vec_size == 0);
+
+        const vec_type two(F(2));
+        for (unsigned int j = 0; j != n; j += vec_size) {
+            vec_type delayed;
+            delayed.load(in + j - half_taps);
+            const vec_type planar[2] = { delayed, two * filter_simd(in + j) };
+
+            vec_type frames[2];
+            interleave_network<2>::interleave_vectors(frames, planar, 1);
+            frames[0].store(out + 2 * j);
+            frames[1].store(out + 2 * j + vec_size);
+        }
+    }
+
+    void downsample_simd(F * out, const F * even, const F * odd, unsigned int n) const
+    {
+        const unsigned int vec_size = vec_type::size;
+        assert(n % vec_size == 0);
+
+        const vec_type half(F(0.5));
+        for (unsigned int j = 0; j != n; j += vec_size) {
+            vec_type delayed;
+            delayed.load(even + j - half_taps);
+            const vec_type result = half * delayed + filter_simd(odd + j - 1);
+            result.store(out + j);
+        }
+    }
+
+    const unsigned int half_taps, taps, max_size;
+    aligned_buffer<F> coefficients;
+    aligned_buffer<F> up_history;       /* taps - 1 samples history, followed by the input */
+    aligned_buffer<F> even_history;     /* half_taps samples history */
+    aligned_buffer<F> odd_history;      /* taps samples history */
+};
+
+}
+
+/* oversampling for nonlinear functions
+ *
+ * runs the signal at 2, 4 or 8 times the sample rate through cascaded half-band polyphase stages, so
+ * that the harmonics generated by a nonlinear function are removed before they alias. the first
+ * stage uses the longest filter, the later stages only have to reject the images above the passband
+ * of the first stage and are shorter. all stages keep their history across blocks.
+ *
+ * upsample returns the internal, aligned buffer of n * factor() samples, which can be processed in
+ * place before calling downsample, e.g.:
+ *
+ *     F * buffer = os.upsample_simd(in, n);
+ *     tanh_vec_simd(buffer, buffer, n * os.factor());
+ *     os.downsample_simd(out, n);
+ *
+ * process and process_simd do the same for a unary functor or a binary functor with a scalar
+ * argument, like the functors in nova::detail. the output is delayed by latency() samples.
+ * the _simd versions require n to be a multiple of vec<F>::size.
+ */
+template <typename F>
+class oversampler
+{
+    typedef vec<F> vec_type;
+    typedef detail::halfband_stage<F> stage_type;
+
+    oversampler(oversampler const &);
+    oversampler & operator=(oversampler const &);
+
+    static const unsigned int max_stages = 3;
+
+public:
+    explicit oversampler(unsigned int factor, unsigned int max_block_size = 64):
+        factor_(factor), stages(0), max_block_size_(max_block_size), buffer(factor * max_block_size)
+    {
+        assert(factor == 1 || factor == 2 || factor == 4 || factor == 8);
+        while ((1u << stages) < factor)
+            ++stages;
+
+        /* half_taps must be a multiple of 2^stage for an integer latency */
+        const unsigned int half_taps[max_stages] = { 12, 4, 2 };
+        const double beta[max_stages] = { 8, 7, 6 };
+
+        std::fill(stage_filters, stage_filters + max_stages, (stage_type*)0);
+
+        /* free the stages that are already built, if a later allocation throws */
+        try {
+            for (unsigned int stage = 0; stage != stages; ++stage)
+                stage_filters[stage] = new stage_type(half_taps[stage], beta[stage], max_block_size << stage);
+        } catch (...) {
+            free_stages();
+            throw;
+        }
+
+        latency_ = 0;
+        for (unsigned int stage = 0; stage != stages; ++stage)
+            latency_ += (2 * half_taps[stage]) >> stage;
+    }
+
+    ~oversampler(void)
+    {
+        free_stages();
+    }
+
+    unsigned int factor(void) const
+    {
+        return factor_;
+    }
+
+    /* delay of the upsampled and downsampled signal, in samples of the original rate */
+    unsigned int latency(void) const
+    {
+        return latency_;
+    }
+
+    void reset(void)
+    {
+        for (unsigned int stage = 0; stage != stages; ++stage)
+            stage_filters[stage]->reset();
+    }
+
+    /* @{ */
+    /** upsample n samples, returns the buffer of n * factor() samples */
+    F * upsample(const F * in, unsigned int n)
+    {
+        return upsample_<false>(in, n);
+    }
+
+    F * upsample_simd(const F * in, unsigned int n)
+    {
+        return upsample_<true>(in, n);
+    }
+    /* @} */
+
+    /* @{ */
+    /** downsample the n * factor() samples of the buffer to n samples */
+    void downsample(F * out, unsigned int n)
+    {
+        downsample_<false>(out, n);
+    }
+
+    void downsample_simd(F * out, unsigned int n)
+    {
+        downsample_<true>(out, n);
+    }
+    /* @} */
+
+    /* @{ */
+    /** apply f to the oversampled signal */
+    template <typename Functor>
+    void process(F * out, const F * in, unsigned int n, Functor const & f)
+    {
+        F * oversampled = upsample(in, n);
+        for (unsigned int i = 0; i != n * factor_; ++i)
+            oversampled[i] = f(oversampled[i]);
+        downsample(out, n);
+    }
+
+    template <typename Functor>
+    void process_simd(F * out, const F * in, unsigned int n, Functor const & f)
+    {
+        F * oversampled = upsample_simd(in, n);
+        for (unsigned int i = 0; i != n * factor_; i += vec_type::size) {
+            vec_type sample;
+            sample.load_aligned(oversampled + i);
+            f(sample).store_aligned(oversampled + i);
+        }
+        downsample_simd(out, n);
+    }
+
+    template <typename Functor>
+    void process(F * out, const F * in, F argument, unsigned int n, Functor const & f)
+    {
+        F * oversampled = upsample(in, n);
+        for (unsigned int i = 0; i != n * factor_; ++i)
+            oversampled[i] = f(oversampled[i], argument);
+        downsample(out, n);
+    }
+
+    template <typename Functor>
+    void process_simd(F * out, const F * in, F argument, unsigned int n, Functor const & f)
+    {
+        F * oversampled = upsample_simd(in, n);
+        const vec_type vector_argument(argument);
+        for (unsigned int i = 0; i != n * factor_; i += vec_type::size) {
+            vec_type sample;
+            sample.load_aligned(oversampled + i);
+            f(sample, vector_argument).store_aligned(oversampled + i);
+        }
+        downsample_simd(out, n);
+    }
+    /* @} */
+
+private:
+    template <bool simd>
+    F * upsample_(const F * in, unsigned int n)
+    {
+        assert(n <= max_block_size_);
+        if (stages == 0) {
+            std::memcpy(buffer.data(), in, n * sizeof(F));
+            return buffer.data();
+        }
+
+        std::memcpy(stage_filters[0]->upsample_input(), in, n * sizeof(F));
+        for (unsigned int stage = 0; stage != stages; ++stage) {
+            F * stage_out = (stage + 1 == stages) ? buffer.data()
+                                                  : stage_filters[stage + 1]->upsample_input();
+            stage_filters[stage]->template upsample<simd>(stage_out, n << stage);
+        }
+        return buffer.data();
+    }
+
+    /* the stages downsample in place, the last one writes to out */
+    template <bool simd>
+    void downsample_(F * out, unsigned int n)
+    {
+        assert(n <= max_block_size_);
+        if (stages == 0) {
+            std::memcpy(out, buffer.data(), n * sizeof(F));
+            return;
+        }
+
+        for (unsigned int stage = stages - 1; stage != 0; --stage)
+            stage_filters[stage]->template downsample<simd>(buffer.data(), buffer.data(), n << stage);
+        stage_filters[0]->template downsample<simd>(out, buffer.data(), n);
+    }
+
+    void free_stages(void)
+    {
+        for (unsigned int stage = 0; stage != stages; ++stage)
+            delete stage_filters[stage];
+    }
+
+    const unsigned int factor_;
+    unsigned int stages;
+    unsigned int latency_;
+    const unsigned int max_block_size_;
+    stage_type * stage_filters[max_stages];
+    detail::aligned_buffer<F> buffer;
+};
+
+} /* namespace nova */
+
+#undef always_inline
+
+#endif /* SIMD_OVERSAMPLER_HPP */
@@ -21,6 +21,10 @@
 #define SIMD_PAN_HPP
 
 #include "vec.hpp"
+#include "detail/define_macros.hpp"
+#include "detail/math.hpp"
+#include "detail/wrap_arguments.hpp"
+#include "detail/wrap_argument_vector.hpp"
 
 #if defined(__GNUC__) && defined(NDEBUG)
 #define always_inline inline  __attribute__((always_inline))
@@ -156,6 +160,129 @@ inline void pan2_vec_simd(F * out0, F * out1, const F * in, F factor0, F slope0,
     detail::pan2<F, n>::mp_iteration(out0, out1, in, vf0, vslope0, vf1, vslope1);
 }
 
+namespace detail
+{
+
+template <typename FloatType>
+always_inline FloatType clip_position(FloatType position)
+{
+    return max_(FloatType(-1.0), min_(position, FloatType(1.0)));
+}
+
+/* equal-power stereo panning, position -1 (left) to 1 (right) */
+struct equal_power_pan
+{
+    template <typename FloatType>
+    always_inline void operator()(FloatType & out0, FloatType & out1, FloatType in, FloatType position) const
+    {
+        const double pi = 3.14159265358979323846264338327950288419716939937510;
+        const FloatType angle = (clip_position(position) + FloatType(1.0)) * FloatType(0.25 * pi);
+        out0 = in * cos(angle);
+        out1 = in * sin(angle);
+    }
+};
+
+/* stereo balance, the center passes both channels, towards one side the other channel is faded
+ * with a quarter cosine */
+struct balance2
+{
+    template <typename FloatType>
+    always_inline void operator()(FloatType & out0, FloatType & out1, FloatType in0, FloatType in1,
+                                  FloatType position, FloatType level) const
+    {
+        const double pi = 3.14159265358979323846264338327950288419716939937510;
+        const FloatType zero(0.0);
+        const FloatType half_pi(0.5 * pi);
+        const FloatType clipped = clip_position(position);
+
+        out0 = in0 * level * cos(max_(clipped, zero) * half_pi);
+        out1 = in1 * level * cos(max_(zero - clipped, zero) * half_pi);
+    }
+};
+
+/* gain of a speaker at the distance (in speakers) from the source in a ring of channels speakers */
+template <typename FloatType>
+always_inline FloatType ring_pan_gain(FloatType distance, FloatType channels, FloatType reciprocal_channels,
+                                      FloatType reciprocal_width)
+{
+    const double pi = 3.14159265358979323846264338327950288419716939937510;
+    const FloatType half(0.5);
+    const FloatType wrapped = distance - channels * floor(distance * reciprocal_channels + half);
+    const FloatType x = max_(FloatType(0.0), min_(wrapped * reciprocal_width + half, FloatType(1.0)));
+    return sin(x * FloatType(pi));
+}
+
+}
+
+NOVA_SIMD_DEFINE_DUAL_OUTPUT_BINARY_WRAPPER(pan2_equal_power, detail::equal_power_pan)
+NOVA_SIMD_DEFINE_DUAL_OUTPUT_4ARY_WRAPPER(balance2, detail::balance2)
+
+namespace detail
+{
+
+template <typename F, typename Arg>
+inline void panaz_vec(F * const * out, unsigned int channels, const F * in, Arg position, F width, unsigned int n)
+{
+    const F ring = F(channels);
+    const F reciprocal_channels = F(1) / ring;
+    const F reciprocal_width = F(1) / width;
+    const F half_ring = F(0.5) * ring;
+
+    for (unsigned int i = 0; i != n; ++i) {
+        const F speaker_position = position.consume() * half_ring;
+        const F sample = in[i];
+        for (unsigned int channel = 0; channel != channels; ++channel)
+            out[channel][i] = sample * ring_pan_gain(speaker_position - F(channel), ring, reciprocal_channels,
+                                                     reciprocal_width);
+    }
+}
+
+template <typename F, typename Arg>
+inline void panaz_vec_simd(F * const * out, unsigned int channels, const F * in, Arg position, F width, unsigned int n)
+{
+    typedef vec<F> vec_type;
+    const unsigned int vec_size = vec_type::size;
+    const vec_type ring = vec_type(F(channels));
+    const vec_type reciprocal_channels = vec_type(F(1) / F(channels));
+    const vec_type reciprocal_width = vec_type(F(1) / width);
+    const vec_type half_ring = vec_type(F(0.5) * F(channels));
+
+    for (unsigned int i = 0; i != n; i += vec_size) {
+        const vec_type speaker_position = position.consume() * half_ring;
+        vec_type sample;
+        sample.load_aligned(in + i);
+        for (unsigned int channel = 0; channel != channels; ++channel) {
+            const vec_type gain = ring_pan_gain(speaker_position - vec_type(F(channel)), ring,
+                                                reciprocal_channels, reciprocal_width);
+            (sample * gain).store_aligned(out[channel] + i);
+        }
+    }
+}
+
+}
+
+/* ring panning to channels speakers (PanAz)
+ *
+ * out is an array of channels buffers. the position runs around the ring from 0 to 2, speaker i sits
+ * at 2 * i / channels. the source is spread over width speakers (width >= 1) with a sine shaped
+ * gain curve, for width 2 the gains of neighboring speakers have constant power. position can be a
+ * scalar, a buffer or a slope argument.
+ *
+ * the gains are computed with vec<F> sin inside the loop, so the position can be modulated per
+ * sample. the _simd version requires n to be a multiple of vec<F>::size and aligned buffers.
+ */
+template <typename F, typename Arg>
+inline void panaz_vec(F * const * out, unsigned int channels, const F * in, Arg position, F width, unsigned int n)
+{
+    detail::panaz_vec(out, channels, in, wrap_argument(position), width, n);
+}
+
+template <typename F, typename Arg>
+inline void panaz_vec_simd(F * const * out, unsigned int channels, const F * in, Arg position, F width, unsigned int n)
+{
+    detail::panaz_vec_simd(out, channels, in, detail::wrap_vector_arg(wrap_argument(position)), width, n);
+}
+
 } /* namespace nova */
 
 #undef always_inline
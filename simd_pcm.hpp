@@ -0,0 +1,405 @@
+//  simd functions for pcm integer <-> floating point conversion
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef SIMD_PCM_HPP
+#define SIMD_PCM_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+#include <stdint.h>
+
+#include "vec.hpp"
+#include "simd_noise.hpp"
+#include "detail/aligned_buffer.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+namespace nova {
+
+enum pcm_dither_type
+{
+    tpdf_dither,                /* triangular dither of +-1 lsb */
+    highpass_tpdf_dither        /* triangular dither with a first-order highpass spectrum */
+};
+
+namespace detail {
+
+struct pcm_int16
+{
+    typedef int16_t value_type;
+    static const unsigned int bits = 16;
+    static const unsigned int values_per_sample = 1;
+
+    static always_inline int32_t read(const value_type * in, unsigned int index)
+    {
+        return in[index];
+    }
+
+    static always_inline void write(value_type * out, unsigned int index, int32_t value)
+    {
+        out[index] = int16_t(value);
+    }
+
+    template <typename VecType>
+    static always_inline void load(VecType & sample, const value_type * in)
+    {
+        sample.load_int16(in);
+    }
+
+    template <typename VecType>
+    static always_inline void store(VecType const & sample, value_type * out)
+    {
+        sample.store_int16(out);
+    }
+};
+
+/* packed little-endian 24 bit samples */
+struct pcm_int24
+{
+    typedef uint8_t value_type;
+    static const unsigned int bits = 24;
+    static const unsigned int values_per_sample = 3;
+
+    static always_inline int32_t read(const value_type * in, unsigned int index)
+    {
+        const uint8_t * sample = in + 3 * index;
+        const uint32_t shifted = (uint32_t(sample[0]) << 8) | (uint32_t(sample[1]) << 16) | (uint32_t(sample[2]) << 24);
+        return int32_t(shifted) >> 8;
+    }
+
+    static always_inline void write(value_type * out, unsigned int index, int32_t value)
+    {
+        uint8_t * sample = out + 3 * index;
+        sample[0] = uint8_t(value);
+        sample[1] = uint8_t(value >> 8);
+        sample[2] = uint8_t(value >> 16);
+    }
+
+    template <typename VecType>
+    static always_inline void load(VecType & sample, const value_type * in)
+    {
+        sample.load_int24(in);
+    }
+
+    template <typename VecType>
+    static always_inline void store(VecType const & sample, value_type * out)
+    {
+        sample.store_int24(out);
+    }
+};
+
+struct pcm_int32
+{
+    typedef int32_t value_type;
+    static const unsigned int bits = 32;
+    static const unsigned int values_per_sample = 1;
+
+    static always_inline int32_t read(const value_type * in, unsigned int index)
+    {
+        return in[index];
+    }
+
+    static always_inline void write(value_type * out, unsigned int index, int32_t value)
+    {
+        out[index] = value;
+    }
+
+    template <typename VecType>
+    static always_inline void load(VecType & sample, const value_type * in)
+    {
+        sample.load_int32(in);
+    }
+
+    template <typename VecType>
+    static always_inline void store(VecType const & sample, value_type * out)
+    {
+        sample.store_int32(out);
+    }
+};
+
+/* scaling and saturation bounds of Format in F */
+template <typename Format, typename F>
+struct pcm_range
+{
+    static F scale(void)
+    {
+        return F(double(1u << (Format::bits - 2)) * 2.0);
+    }
+
+    static F minimum(void)
+    {
+        return -scale();
+    }
+
+    /* the largest F that converts to a valid sample, 2^31 - 1 is not representable as float */
+    static F maximum(void)
+    {
+        const double largest = double(scale()) - 1;
+        const F ret = F(largest);
+        if (double(ret) <= largest)
+            return ret;
+        return F(double(scale()) * (1.0 - 0.5 * std::numeric_limits<F>::epsilon()));
+    }
+};
+
+template <typename Format, typename F>
+inline void pcm_to_float_vec(F * out, const typename Format::value_type * in, unsigned int n)
+{
+    const F scale = F(1) / pcm_range<Format, F>::scale();
+    for (unsigned int i = 0; i != n; ++i)
+        out[i] = F(Format::read(in, i)) * scale;
+}
+
+template <typename Format, typename F>
+inline void pcm_to_float_vec_simd(F * out, const typename Format::value_type * in, unsigned int n)
+{
+    typedef vec<F> vec_type;
+    const unsigned int vec_size = vec_type::size;
+    assert(n % vec_size == 0);
+
+    const vec_type scale(F(1) / pcm_range<Format, F>::scale());
+    for (unsigned int i = 0; i != n; i += vec_size) {
+        vec_type sample;
+        Format::load(sample, in + i * Format::values_per_sample);
+        (sample * scale).store_aligned(out + i);
+    }
+}
+
+/* dither is given in lsb, or 0 */
+template <typename Format, typename F>
+inline void float_to_pcm_vec(typename Format::value_type * out, const F * in, const F * dither, unsigned int n)
+{
+    typedef pcm_range<Format, F> range;
+    const F scale = range::scale();
+    const F minimum = range::minimum();
+    const F maximum = range::maximum();
+
+    for (unsigned int i = 0; i != n; ++i) {
+        F sample = in[i] * scale;
+        if (dither)
+            sample += dither[i];
+        sample = std::max(minimum, std::min(maximum, sample));
+        Format::write(out, i, int32_t(std::floor(sample + F(0.5))));
+    }
+}
+
+template <typename Format, typename F>
+inline void float_to_pcm_vec_simd(typename Format::value_type * out, const F * in, const F * dither, unsigned int n)
+{
+    typedef vec<F> vec_type;
+    typedef pcm_range<Format, F> range;
+    const unsigned int vec_size = vec_type::size;
+    assert(n % vec_size == 0);
+
+    const vec_type scale(range::scale());
+    const vec_type minimum(range::minimum());
+    const vec_type maximum(range::maximum());
+    const vec_type half(F(0.5));
+
+    for (unsigned int i = 0; i != n; i += vec_size) {
+        vec_type sample;
+        sample.load_aligned(in + i);
+        sample = sample * scale;
+        if (dither) {
+            vec_type noise;
+            noise.load_aligned(dither + i);
+            sample = sample + noise;
+        }
+        sample = floor(max_(minimum, min_(maximum, sample)) + half);
+
+        /* the values are integral and in range, so the conversion is exact */
+        Format::store(sample, out + i * Format::values_per_sample);
+    }
+}
+
+}
+
+/* pcm conversion
+ *
+ * integer samples are converted to [-1, 1) by dividing by 2^(bits-1). floating point samples are
+ * scaled by 2^(bits-1), saturated and rounded to the nearest integer. int24 buffers hold packed
+ * little-endian 3-byte samples.
+ *
+ * the _simd versions require n to be a multiple of vec<F>::size and the floating point buffer to be
+ * aligned, the integer buffers do not need to be aligned.
+ */
+
+#define NOVA_SIMD_DEFINE_PCM_CONVERSION(NAME, FORMAT)                                               \
+template <typename F>                                                                               \
+inline void NAME##_to_float_vec(F * out, const detail::FORMAT::value_type * in, unsigned int n)     \
+{                                                                                                   \
+    detail::pcm_to_float_vec<detail::FORMAT>(out, in, n);                                           \
+}                                                                                                   \
+                                                                                                    \
+template <typename F>                                                                               \
+inline void NAME##_to_float_vec_simd(F * out, const detail::FORMAT::value_type * in, unsigned int n) \
+{                                                                                                   \
+    detail::pcm_to_float_vec_simd<detail::FORMAT>(out, in, n);                                      \
+}                                                                                                   \
+                                                                                                    \
+template <typename F>                                                                               \
+inline void float_to_##NAME##_vec(detail::FORMAT::value_type * out, const F * in, unsigned int n)   \
+{                                                                                                   \
+    detail::float_to_pcm_vec<detail::FORMAT>(out, in, (const F*)0, n);                             \
+}                                                                                                   \
+                                                                                                    \
+template <typename F>                                                                               \
+inline void float_to_##NAME##_vec_simd(detail::FORMAT::value_type * out, const F * in, unsigned int n) \
+{                                                                                                   \
+    detail::float_to_pcm_vec_simd<detail::FORMAT>(out, in, (const F*)0, n);                        \
+}
+
+NOVA_SIMD_DEFINE_PCM_CONVERSION(int16, pcm_int16)
+NOVA_SIMD_DEFINE_PCM_CONVERSION(int24, pcm_int24)
+NOVA_SIMD_DEFINE_PCM_CONVERSION(int32, pcm_int32)
+
+#undef NOVA_SIMD_DEFINE_PCM_CONVERSION
+
+
+/* dithered conversion to pcm
+ *
+ * the dither is generated by a noise_generator, whose xorshift states are updated in the integer
+ * units of vec<float>. tpdf_dither adds the average of two uniform random numbers, highpass_tpdf_dither
+ * adds half of the difference of two consecutive uniform random numbers, which has the same
+ * distribution, but shifts the noise power towards high frequencies.
+ *
+ * the scalar and _simd versions generate the same output. the _simd versions require n to be a
+ * multiple of pcm_dither<F>::lanes.
+ */
+template <typename F>
+class pcm_dither
+{
+    typedef vec<F> vec_type;
+    typedef noise_generator<F> generator_type;
+
+    static const unsigned int block_size = 64;
+
+    pcm_dither(pcm_dither const &);
+    pcm_dither & operator=(pcm_dither const &);
+
+public:
+    static const unsigned int lanes = generator_type::lanes;
+
+    explicit pcm_dither(pcm_dither_type type = tpdf_dither, uint32_t seed = 1):
+        type_(type), noise(seed), random(2 * block_size + lanes), dither(block_size)
+    {}
+
+    /* @{ */
+    /** dithered conversion */
+    void float_to_int16(int16_t * out, const F * in, unsigned int n)
+    {
+        convert<detail::pcm_int16, false>(out, in, n);
+    }
+
+    void float_to_int16_simd(int16_t * out, const F * in, unsigned int n)
+    {
+        convert<detail::pcm_int16, true>(out, in, n);
+    }
+
+    void float_to_int24(uint8_t * out, const F * in, unsigned int n)
+    {
+        convert<detail::pcm_int24, false>(out, in, n);
+    }
+
+    void float_to_int24_simd(uint8_t * out, const F * in, unsigned int n)
+    {
+        convert<detail::pcm_int24, true>(out, in, n);
+    }
+
+    void float_to_int32(int32_t * out, const F * in, unsigned int n)
+    {
+        convert<detail::pcm_int32, false>(out, in, n);
+    }
+
+    void float_to_int32_simd(int32_t * out, const F * in, unsigned int n)
+    {
+        convert<detail::pcm_int32, true>(out, in, n);
+    }
+    /* @} */
+
+private:
+    template <typename Format, bool simd>
+    void convert(typename Format::value_type * out, const F * in, unsigned int n)
+    {
+        if (simd)
+            assert(n % lanes == 0);
+
+        for (unsigned int done = 0; done != n;) {
+            const unsigned int count = (n - done < block_size) ? n - done : block_size;
+            generate_dither<simd>(count);
+
+            if (simd)
+                detail::float_to_pcm_vec_simd<Format>(out + done * Format::values_per_sample,
+                                                      in + done, dither.data(), count);
+            else
+                detail::float_to_pcm_vec<Format>(out + done * Format::values_per_sample,
+                                                 in + done, dither.data(), count);
+            done += count;
+        }
+    }
+
+    /* random holds the last random number of the previous block at lanes - 1, followed by the
+     * random numbers of the current block */
+    template <bool simd>
+    void generate_dither(unsigned int n)
+    {
+        F * current = random.data() + lanes;
+        if (simd)
+            noise.white_simd(current, (type_ == tpdf_dither) ? 2 * n : n);
+        else
+            noise.white(current, (type_ == tpdf_dither) ? 2 * n : n);
+
+        const F * other = (type_ == tpdf_dither) ? current + n : current - 1;
+        const F sign = (type_ == tpdf_dither) ? F(0.5) : F(-0.5);
+
+        if (simd) {
+            const vec_type half(F(0.5));
+            const vec_type signed_half(sign);
+            for (unsigned int i = 0; i != n; i += vec_type::size) {
+                vec_type a, b;
+                a.load_aligned(current + i);
+                b.load(other + i);
+                (a * half + b * signed_half).store_aligned(dither.data() + i);
+            }
+        } else {
+            for (unsigned int i = 0; i != n; ++i)
+                dither[i] = current[i] * F(0.5) + other[i] * sign;
+        }
+
+        if (type_ == highpass_tpdf_dither)
+            current[-1] = current[n - 1];
+    }
+
+    const pcm_dither_type type_;
+    generator_type noise;
+    detail::aligned_buffer<F> random;
+    detail::aligned_buffer<F> dither;
+};
+
+} /* namespace nova */
+
+#undef always_inline
+
+#endif /* SIMD_PCM_HPP */
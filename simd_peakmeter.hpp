@@ -21,9 +21,13 @@
 #define SIMD_PEAKMETER_HPP
 
 #include "vec.hpp"
+#include "detail/aligned_buffer.hpp"
+#include "detail/interleave_network.hpp"
 
+#include <cassert>
 #include <cmath>                /* for abs */
 #include <algorithm>            /* for max */
+#include <limits>
 
 #if defined(__GNUC__) && defined(NDEBUG)
 #define always_inline inline  __attribute__((always_inline))
@@ -150,6 +154,428 @@ inline void peak_rms_vec_simd(const F * in, F * peak, F * squared_sum, unsigned
 }
 
 
+namespace detail
+{
+
+/* per-channel state update of the batched peak meter */
+struct peak_accumulate
+{
+    template <typename F>
+    always_inline void operator()(F block_peak, F & peak, F &) const
+    {
+        peak = std::max(peak, block_peak);
+    }
+
+    template <typename F>
+    always_inline void operator()(vec<F> block_peak, vec<F> & peak, vec<F> &) const
+    {
+        peak = max_(peak, block_peak);
+    }
+};
+
+/* a new peak is held for hold_blocks calls, afterwards it decays by decay per call */
+template <typename F>
+struct peak_decay_hold
+{
+    peak_decay_hold(F hold_blocks, F decay):
+        hold_blocks(hold_blocks), decay(decay)
+    {}
+
+    always_inline void operator()(F block_peak, F & peak, F & hold) const
+    {
+        if (block_peak >= peak) {
+            peak = block_peak;
+            hold = hold_blocks;
+        } else if (hold > F(0))
+            hold -= F(1);
+        else
+            peak = std::max(block_peak, peak * decay);
+    }
+
+    always_inline void operator()(vec<F> block_peak, vec<F> & peak, vec<F> & hold) const
+    {
+        const vec<F> zero(F(0));
+        const vec<F> new_peak = mask_ge(block_peak, peak);
+        const vec<F> holding = mask_gt(hold, zero);
+
+        const vec<F> decayed = select(max_(block_peak, peak * vec<F>(decay)), peak, holding);
+        peak = select(decayed, block_peak, new_peak);
+        hold = select(max_(hold - vec<F>(F(1)), zero), vec<F>(hold_blocks), new_peak);
+    }
+
+    const F hold_blocks, decay;
+};
+
+/* maximum and squared sum of one channel in the lanes of two vectors */
+template <typename F>
+always_inline void peak_rms_partials(const F * in, vec<F> & maximum, vec<F> & squared_sum, unsigned int n)
+{
+    const unsigned int vec_size = vec<F>::size;
+    maximum.clear();
+    squared_sum.clear();
+    for (unsigned int i = 0; i != n; i += vec_size) {
+        vec<F> sample;
+        sample.load_aligned(in + i);
+        maximum = max_(maximum, abs(sample));
+        squared_sum += square(sample);
+    }
+}
+
+template <typename F, typename Update>
+inline void peak_rms_vec(const F * const * in, F * peaks, F * squared_sums, F * hold,
+                         unsigned int channels, unsigned int n, Update const & update)
+{
+    F unused = 0;
+    for (unsigned int channel = 0; channel != channels; ++channel) {
+        const F * channel_in = in[channel];
+        F block_peak = 0;
+        F squared_sum = 0;
+        for (unsigned int i = 0; i != n; ++i) {
+            const F sample = channel_in[i];
+            block_peak = std::max(block_peak, F(std::fabs(sample)));
+            squared_sum += sample * sample;
+        }
+
+        update(block_peak, peaks[channel], hold ? hold[channel] : unused);
+        squared_sums[channel] += squared_sum;
+    }
+}
+
+/* the partial results of vec_size channels are transposed, so that a vertical reduction yields the
+ * results of all channels in one vector */
+template <typename F, typename Update>
+inline void peak_rms_vec_simd(const F * const * in, F * peaks, F * squared_sums, F * hold,
+                              unsigned int channels, unsigned int n, Update const & update)
+{
+    typedef vec<F> vec_type;
+    const unsigned int vec_size = vec_type::size;
+    assert(n % vec_size == 0);
+
+    vec_type unused_hold;
+    unused_hold.clear();
+
+    unsigned int channel = 0;
+    for (; channel + vec_size <= channels; channel += vec_size) {
+        vec_type maxima[vec_size], sums[vec_size];
+        for (unsigned int lane = 0; lane != vec_size; ++lane)
+            peak_rms_partials(in[channel + lane], maxima[lane], sums[lane], n);
+
+        vec_type transposed_maxima[vec_size], transposed_sums[vec_size];
+        interleave_network<vec_size>::interleave_vectors(transposed_maxima, maxima, 1);
+        interleave_network<vec_size>::interleave_vectors(transposed_sums, sums, 1);
+
+        vec_type block_peak = transposed_maxima[0];
+        vec_type squared_sum = transposed_sums[0];
+        for (unsigned int i = 1; i != vec_size; ++i) {
+            block_peak = max_(block_peak, transposed_maxima[i]);
+            squared_sum += transposed_sums[i];
+        }
+
+        vec_type peak, accumulated;
+        peak.load(peaks + channel);
+        accumulated.load(squared_sums + channel);
+        if (hold) {
+            vec_type channel_hold;
+            channel_hold.load(hold + channel);
+            update(block_peak, peak, channel_hold);
+            channel_hold.store(hold + channel);
+        } else
+            update(block_peak, peak, unused_hold);
+
+        peak.store(peaks + channel);
+        (accumulated + squared_sum).store(squared_sums + channel);
+    }
+
+    /* remaining channels */
+    F unused = 0;
+    for (; channel != channels; ++channel) {
+        vec_type maximum, squared_sum;
+        peak_rms_partials(in[channel], maximum, squared_sum, n);
+
+        update(maximum.horizontal_max(), peaks[channel], hold ? hold[channel] : unused);
+        squared_sums[channel] += squared_sum.horizontal_sum();
+    }
+}
+
+}
+
+/* batched peak/rms metering
+ *
+ * in, peaks and squared_sums are arrays of channels buffers/values. updates peaks and squared sums
+ * like peak_rms_vec for each channel. with decay and hold, a new peak is held for hold_blocks calls,
+ * afterwards the peak is multiplied by decay once per call. hold keeps the remaining hold time of
+ * each channel.
+ *
+ * the _simd versions require n to be a multiple of vec<F>::size and aligned input buffers.
+ */
+
+/* @{ */
+template <typename F>
+inline void peak_rms_vec(const F * const * in, F * peaks, F * squared_sums, unsigned int channels, unsigned int n)
+{
+    detail::peak_rms_vec(in, peaks, squared_sums, (F*)0, channels, n, detail::peak_accumulate());
+}
+
+template <typename F>
+inline void peak_rms_vec_simd(const F * const * in, F * peaks, F * squared_sums, unsigned int channels, unsigned int n)
+{
+    detail::peak_rms_vec_simd(in, peaks, squared_sums, (F*)0, channels, n, detail::peak_accumulate());
+}
+
+template <typename F>
+inline void peak_rms_vec(const F * const * in, F * peaks, F * squared_sums, F * hold, F hold_blocks, F decay,
+                         unsigned int channels, unsigned int n)
+{
+    detail::peak_rms_vec(in, peaks, squared_sums, hold, channels, n, detail::peak_decay_hold<F>(hold_blocks, decay));
+}
+
+template <typename F>
+inline void peak_rms_vec_simd(const F * const * in, F * peaks, F * squared_sums, F * hold, F hold_blocks, F decay,
+                              unsigned int channels, unsigned int n)
+{
+    detail::peak_rms_vec_simd(in, peaks, squared_sums, hold, channels, n, detail::peak_decay_hold<F>(hold_blocks, decay));
+}
+/* @} */
+
+
+namespace detail
+{
+
+struct window_maximum
+{
+    template <typename F>
+    static always_inline F identity(void)
+    {
+        return -std::numeric_limits<F>::max();
+    }
+
+    template <typename F>
+    static always_inline F combine(F lhs, F rhs)
+    {
+        return std::max(lhs, rhs);
+    }
+
+    template <typename F>
+    static always_inline vec<F> combine(vec<F> lhs, vec<F> rhs)
+    {
+        return max_(lhs, rhs);
+    }
+};
+
+struct window_minimum
+{
+    template <typename F>
+    static always_inline F identity(void)
+    {
+        return std::numeric_limits<F>::max();
+    }
+
+    template <typename F>
+    static always_inline F combine(F lhs, F rhs)
+    {
+        return std::min(lhs, rhs);
+    }
+
+    template <typename F>
+    static always_inline vec<F> combine(vec<F> lhs, vec<F> rhs)
+    {
+        return min_(lhs, rhs);
+    }
+};
+
+/* in-register prefix/suffix extrema in log2(vec_size) steps. the shifts repeat the first/last lane
+ * instead of shifting in the identity, which does not change the result, since extrema are idempotent.
+ * the recursion keeps the shift counts compile-time constants */
+template <typename Policy, typename VecType, unsigned int Count = 1, unsigned int Size = VecType::size>
+struct window_scan
+{
+    static always_inline VecType prefix(VecType arg)
+    {
+        return window_scan<Policy, VecType, Count * 2, Size>::prefix(Policy::combine(arg, shift_lanes_up(arg, Count)));
+    }
+
+    static always_inline VecType suffix(VecType arg)
+    {
+        return window_scan<Policy, VecType, Count * 2, Size>::suffix(Policy::combine(arg, shift_lanes_down(arg, Count)));
+    }
+};
+
+template <typename Policy, typename VecType, unsigned int Size>
+struct window_scan<Policy, VecType, Size, Size>
+{
+    static always_inline VecType prefix(VecType arg)
+    {
+        return arg;
+    }
+
+    static always_inline VecType suffix(VecType arg)
+    {
+        return arg;
+    }
+};
+
+/* streaming van Herk/Gil-Werman filter
+ *
+ * the input is split into blocks of window samples. the window ending at position p of a block
+ * consists of the samples from position p+1 to the end of the previous block and of the samples from
+ * the beginning of the current block to p. so its extremum combines the suffix extremum of the
+ * previous block with the prefix extremum of the current one, which costs 3 comparisons per sample,
+ * independent of the window size.
+ */
+template <typename F, typename Policy>
+class sliding_window
+{
+    typedef vec<F> vec_type;
+
+    sliding_window(sliding_window const &);
+    sliding_window & operator=(sliding_window const &);
+
+public:
+    explicit sliding_window(unsigned int window):
+        window_(window), block(window), suffix(window + 1)
+    {
+        assert(window > 0);
+        reset();
+    }
+
+    unsigned int window(void) const
+    {
+        return window_;
+    }
+
+    /* samples before the first call are ignored */
+    void reset(void)
+    {
+        for (unsigned int i = 0; i != window_ + 1; ++i)
+            suffix[i] = Policy::template identity<F>();
+        prefix = Policy::template identity<F>();
+        position = 0;
+    }
+
+    void process(F * out, const F * in, unsigned int n)
+    {
+        process_<false>(out, in, n);
+    }
+
+    void process_simd(F * out, const F * in, unsigned int n)
+    {
+        process_<true>(out, in, n);
+    }
+
+private:
+    template <bool simd>
+    void process_(F * out, const F * in, unsigned int n)
+    {
+        while (n) {
+            const unsigned int remaining = window_ - position;
+            const unsigned int segment = n < remaining ? n : remaining;
+
+            /* prefix of the current block combined with the suffix of the previous block, out may alias in */
+            F * block_in = block.data() + position;
+            const F * previous = suffix.data() + position + 1;
+            F running = prefix;
+            unsigned int i = 0;
+            if (simd) {
+                const unsigned int vec_size = vec_type::size;
+                vec_type running_vec(running);
+                for (; i + vec_size <= segment; i += vec_size) {
+                    vec_type samples, suffixes;
+                    samples.load(in + i);
+                    suffixes.load(previous + i);
+                    samples.store(block_in + i);
+
+                    const vec_type prefixes = Policy::combine(window_scan<Policy, vec_type>::prefix(samples), running_vec);
+                    running_vec = shift_lanes_down(prefixes, vec_size - 1);
+                    Policy::combine(prefixes, suffixes).store(out + i);
+                }
+                running = running_vec.get(0);
+            }
+
+            for (; i != segment; ++i) {
+                const F sample = in[i];
+                block_in[i] = sample;
+                running = Policy::combine(running, sample);
+                out[i] = Policy::combine(running, previous[i]);
+            }
+            prefix = running;
+
+            position += segment;
+            in += segment;
+            out += segment;
+            n -= segment;
+
+            if (position == window_)
+                next_block<simd>();
+        }
+    }
+
+    template <bool simd>
+    void next_block(void)
+    {
+        F running = Policy::template identity<F>();
+        unsigned int i = window_;
+        if (simd) {
+            /* the tail of the block is scanned first, so that the vectors end at the block boundary */
+            const unsigned int vec_size = vec_type::size;
+            for (const unsigned int head = window_ - window_ % vec_size; i != head; --i) {
+                running = Policy::combine(running, block[i - 1]);
+                suffix[i - 1] = running;
+            }
+
+            vec_type running_vec(running);
+            for (; i != 0; i -= vec_size) {
+                vec_type samples;
+                samples.load(block.data() + i - vec_size);
+
+                const vec_type suffixes = Policy::combine(window_scan<Policy, vec_type>::suffix(samples), running_vec);
+                running_vec = shift_lanes_up(suffixes, vec_size - 1);
+                suffixes.store(suffix.data() + i - vec_size);
+            }
+        }
+
+        for (; i != 0; --i) {
+            running = Policy::combine(running, block[i - 1]);
+            suffix[i - 1] = running;
+        }
+        prefix = Policy::template identity<F>();
+        position = 0;
+    }
+
+    const unsigned int window_;
+    aligned_buffer<F> block;        /* samples of the current block */
+    aligned_buffer<F> suffix;       /* suffix extrema of the previous block, followed by the identity */
+    F prefix;
+    unsigned int position;
+};
+
+}
+
+/* sliding window maximum/minimum
+ *
+ * computes the maximum/minimum of the last window samples. the state persists across calls, so
+ * blocks of any size can be processed. the _simd versions compute the prefix and suffix extrema with
+ * in-register scans of vec<F>, they have no alignment or block size requirements.
+ */
+template <typename F>
+class sliding_window_max:
+    public detail::sliding_window<F, detail::window_maximum>
+{
+public:
+    explicit sliding_window_max(unsigned int window):
+        detail::sliding_window<F, detail::window_maximum>(window)
+    {}
+};
+
+template <typename F>
+class sliding_window_min:
+    public detail::sliding_window<F, detail::window_minimum>
+{
+public:
+    explicit sliding_window_min(unsigned int window):
+        detail::sliding_window<F, detail::window_minimum>(window)
+    {}
+};
+
 } /* namespace nova */
 
 #undef always_inline
@@ -0,0 +1,322 @@
+//  simd polyphase sample-rate converter
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef SIMD_RESAMPLER_HPP
+#define SIMD_RESAMPLER_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "vec.hpp"
+#include "detail/aligned_buffer.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+namespace nova {
+
+enum resampler_quality
+{
+    resampler_low_quality,          /* 16 taps, scaled by the ratio for downsampling */
+    resampler_medium_quality,       /* 32 taps */
+    resampler_high_quality          /* 64 taps */
+};
+
+namespace detail {
+
+/* modified bessel function of the first kind, order 0 */
+inline double bessel_i0(double x)
+{
+    const double q = 0.25 * x * x;
+    double term = 1, sum = 1;
+    for (int k = 1; term > sum * 1e-17; ++k) {
+        term *= q / (double(k) * double(k));
+        sum += term;
+    }
+    return sum;
+}
+
+inline unsigned int greatest_common_divisor(unsigned int a, unsigned int b)
+{
+    while (b) {
+        const unsigned int r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+template <typename F>
+always_inline F dot_product(const F * in, const F * coefficients, unsigned int n)
+{
+    F sum = 0;
+    for (unsigned int i = 0; i != n; ++i)
+        sum += in[i] * coefficients[i];
+    return sum;
+}
+
+/* in can be unaligned, coefficients must be aligned, n must be a multiple of 2 * vec<F>::size */
+template <typename F>
+always_inline F dot_product_simd(const F * in, const F * coefficients, unsigned int n)
+{
+    typedef vec<F> vec_type;
+    const unsigned int vec_size = vec_type::size;
+
+    vec_type sum0, sum1;
+    sum0.clear();
+    sum1.clear();
+
+    for (unsigned int i = 0; i != n; i += 2 * vec_size) {
+        vec_type in0, in1, c0, c1;
+        in0.load(in + i);
+        in1.load(in + i + vec_size);
+        c0.load_aligned(coefficients + i);
+        c1.load_aligned(coefficients + i + vec_size);
+        sum0 += in0 * c0;
+        sum1 += in1 * c1;
+    }
+    return (sum0 + sum1).horizontal_sum();
+}
+
+}
+
+/* polyphase windowed-sinc resampler
+ *
+ * rational ratios (given as integer sample rates, e.g. 44100 -> 48000) are computed exactly with one
+ * coefficient set per phase, as long as the reduced ratio has at most max_rational_phases phases.
+ * other ratios use arbitrary_phases coefficient sets and interpolate linearly between the two
+ * nearest sets. the coefficients are kaiser-windowed sincs, normalized to unity gain at dc; for
+ * downsampling the cutoff follows the output nyquist frequency.
+ *
+ * the resampler is streaming: process consumes all input samples, stores the filter history and
+ * returns the number of output samples. output sample k is the input signal evaluated at the time
+ * k * input_rate / output_rate, so the signal is not delayed, but an output sample is only available
+ * once latency() input samples after it have been received.
+ */
+template <typename F>
+class resampler
+{
+    resampler(resampler const &);
+    resampler & operator=(resampler const &);
+
+public:
+    static const unsigned int max_rational_phases = 1024;
+    static const unsigned int arbitrary_phases = 256;
+
+    resampler(unsigned int input_rate, unsigned int output_rate, unsigned int max_block_size = 1024,
+              resampler_quality quality = resampler_medium_quality)
+    {
+        const unsigned int divisor = detail::greatest_common_divisor(input_rate, output_rate);
+        const unsigned int up = output_rate / divisor;
+        const unsigned int down = input_rate / divisor;
+
+        if (up <= max_rational_phases)
+            init(up, down, double(down) / double(up), max_block_size, quality);
+        else
+            init(0, 0, double(input_rate) / double(output_rate), max_block_size, quality);
+    }
+
+    /* ratio: output rate / input rate */
+    explicit resampler(double ratio, unsigned int max_block_size = 1024,
+                       resampler_quality quality = resampler_medium_quality)
+    {
+        init(0, 0, 1.0 / ratio, max_block_size, quality);
+    }
+
+    /* lookahead in input samples: output k is computed once the input sample after its time plus
+     * latency() - 1 samples have been received */
+    unsigned int latency(void) const
+    {
+        return taps_ / 2;
+    }
+
+    unsigned int taps(void) const
+    {
+        return taps_;
+    }
+
+    bool is_rational(void) const
+    {
+        return up_ != 0;
+    }
+
+    /* upper bound for the number of output samples of a process call */
+    unsigned int max_output_size(unsigned int input_size) const
+    {
+        return (unsigned int)(std::ceil(double(input_size) / step_)) + 1;
+    }
+
+    void reset(void)
+    {
+        history.clear();
+        filled = taps_ / 2 - 1;
+        position = 0;
+        phase = 0;
+        fractional_phase = 0;
+    }
+
+    unsigned int process(const F * in, unsigned int n, F * out)
+    {
+        return process_<false>(in, n, out);
+    }
+
+    unsigned int process_simd(const F * in, unsigned int n, F * out)
+    {
+        return process_<true>(in, n, out);
+    }
+
+private:
+    void init(unsigned int up, unsigned int down, double step, unsigned int max_block_size,
+              resampler_quality quality)
+    {
+        up_ = up;
+        down_ = down;
+        step_ = step;
+        max_block_size_ = max_block_size;
+
+        double beta, rolloff;
+        switch (quality) {
+        case resampler_low_quality:
+            taps_ = 16; beta = 6; rolloff = 0.85;
+            break;
+
+        case resampler_high_quality:
+            taps_ = 64; beta = 10; rolloff = 0.95;
+            break;
+
+        default:
+            taps_ = 32; beta = 8; rolloff = 0.9;
+        }
+
+        /* for downsampling, the filter length grows with the ratio to keep the transition band */
+        if (step > 1)
+            taps_ *= (unsigned int)std::ceil(step);
+
+        const unsigned int sets = up ? up : arbitrary_phases + 1;
+        const double cutoff = rolloff * std::min(1.0, 1.0 / step);
+        compute_coefficients(sets, up ? up : arbitrary_phases, cutoff, beta);
+
+        history.resize(taps_ + max_block_size);
+        reset();
+    }
+
+    /* set p evaluates the input at the fractional time p / phases after tap taps/2 - 1 */
+    void compute_coefficients(unsigned int sets, unsigned int phases, double cutoff, double beta)
+    {
+        const double pi = 3.14159265358979323846264338327950288419716939937510;
+        const double half_length = taps_ / 2;
+        const double normalization = 1.0 / detail::bessel_i0(beta);
+
+        coefficients.resize(sets * taps_);
+        for (unsigned int set = 0; set != sets; ++set) {
+            F * c = coefficients.data() + set * taps_;
+            const double offset = double(set) / double(phases);
+
+            double sum = 0;
+            std::vector<double> values(taps_);
+            for (unsigned int j = 0; j != taps_; ++j) {
+                const double x = double(j) - (half_length - 1) - offset;
+                const double r = x / half_length;
+                const double window = std::abs(r) < 1 ? detail::bessel_i0(beta * std::sqrt(1 - r * r)) * normalization
+                                                      : 0;
+                const double arg = pi * cutoff * x;
+                const double sinc = x == 0 ? 1 : std::sin(arg) / arg;
+                values[j] = sinc * window;
+                sum += values[j];
+            }
+
+            for (unsigned int j = 0; j != taps_; ++j)
+                c[j] = F(values[j] / sum);
+        }
+    }
+
+    template <bool simd>
+    F dot(const F * in, const F * c) const
+    {
+        return simd ? detail::dot_product_simd(in, c, taps_)
+                    : detail::dot_product(in, c, taps_);
+    }
+
+    template <bool simd>
+    unsigned int process_(const F * in, unsigned int n, F * out)
+    {
+        assert(n <= max_block_size_);
+        F * buf = history.data();
+        std::memcpy(buf + filled, in, n * sizeof(F));
+        filled += n;
+
+        unsigned int produced = 0;
+        if (up_) {
+            while (position + taps_ <= filled) {
+                out[produced++] = dot<simd>(buf + position, coefficients.data() + phase * taps_);
+
+                phase += down_;
+                position += phase / up_;
+                phase %= up_;
+            }
+        } else {
+            while (position + taps_ <= filled) {
+                const double scaled = fractional_phase * arbitrary_phases;
+                const unsigned int set = std::min((unsigned int)scaled, arbitrary_phases - 1);
+                const F t = F(scaled - set);
+
+                const F * c = coefficients.data() + set * taps_;
+                const F y0 = dot<simd>(buf + position, c);
+                const F y1 = dot<simd>(buf + position, c + taps_);
+                out[produced++] = y0 + t * (y1 - y0);
+
+                fractional_phase += step_;
+                const double advance = std::floor(fractional_phase);
+                position += (unsigned int)advance;
+                fractional_phase -= advance;
+            }
+        }
+
+        /* keep the history of the next output */
+        const unsigned int consumed = std::min(position, filled);
+        std::memmove(buf, buf + consumed, (filled - consumed) * sizeof(F));
+        filled -= consumed;
+        position -= consumed;
+        return produced;
+    }
+
+    detail::aligned_buffer<F> coefficients;
+    detail::aligned_buffer<F> history;
+
+    unsigned int taps_;
+    unsigned int up_, down_;
+    double step_;
+    unsigned int max_block_size_;
+
+    unsigned int filled;            /* valid samples in history */
+    unsigned int position;          /* first input sample of the next output */
+    unsigned int phase;             /* rational: phase of the next output, in 1/up_ */
+    double fractional_phase;        /* arbitrary: phase of the next output */
+};
+
+} /* namespace nova */
+
+#undef always_inline
+
+#endif /* SIMD_RESAMPLER_HPP */
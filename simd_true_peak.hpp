@@ -0,0 +1,190 @@
+//  simd true-peak meter
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef SIMD_TRUE_PEAK_HPP
+#define SIMD_TRUE_PEAK_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+#include "vec.hpp"
+#include "simd_resampler.hpp"
+#include "detail/aligned_buffer.hpp"
+
+namespace nova {
+
+/* true-peak (inter-sample peak) meter
+ *
+ * the signal is upsampled by 4 with a polyphase filter of 12 taps per phase (kaiser-windowed sinc,
+ * cut off at the nyquist frequency of the input, so phase 0 passes the samples unchanged) and the
+ * maximum absolute value of all phases is tracked. the interpolated samples lag the input by
+ * latency() samples.
+ *
+ * process_simd computes vec<F>::size consecutive outputs of each phase at once and takes their
+ * maximum in the same pass, it requires n to be a multiple of vec<F>::size.
+ */
+template <typename F>
+class true_peak_meter
+{
+    typedef vec<F> vec_type;
+
+    true_peak_meter(true_peak_meter const &);
+    true_peak_meter & operator=(true_peak_meter const &);
+
+public:
+    static const unsigned int oversampling = 4;
+    static const unsigned int taps = 12;
+
+    explicit true_peak_meter(unsigned int max_block_size = 64):
+        max_block_size_(max_block_size), coefficients(oversampling * taps),
+        vector_coefficients(oversampling * taps * vec_type::size), history(taps - 1 + max_block_size)
+    {
+        compute_coefficients(6.0);
+        reset();
+    }
+
+    unsigned int latency(void) const
+    {
+        return taps / 2 - 1;
+    }
+
+    /* maximum since the last reset */
+    F peak(void) const
+    {
+        return peak_;
+    }
+
+    void reset_peak(void)
+    {
+        peak_ = 0;
+    }
+
+    void reset(void)
+    {
+        history.clear();
+        reset_peak();
+    }
+
+    /* @{ */
+    /** update the peak, return the true peak of the block */
+    F process(const F * in, unsigned int n)
+    {
+        const F * buf = fill_history(in, n);
+
+        F block_peak = 0;
+        for (unsigned int i = 0; i != n; ++i) {
+            for (unsigned int phase = 0; phase != oversampling; ++phase) {
+                const F * c = coefficients.data() + phase * taps;
+                F sum = 0;
+                for (unsigned int j = 0; j != taps; ++j)
+                    sum += buf[i + j] * c[j];
+                block_peak = std::max(block_peak, F(std::fabs(sum)));
+            }
+        }
+
+        return update(n, block_peak);
+    }
+
+    F process_simd(const F * in, unsigned int n)
+    {
+        const unsigned int vec_size = vec_type::size;
+        assert(n % vec_size == 0);
+        const F * buf = fill_history(in, n);
+
+        vec_type maximum;
+        maximum.clear();
+        for (unsigned int i = 0; i != n; i += vec_size) {
+            vec_type samples[taps];
+            for (unsigned int j = 0; j != taps; ++j)
+                samples[j].load(buf + i + j);
+
+            for (unsigned int phase = 0; phase != oversampling; ++phase) {
+                const F * c = vector_coefficients.data() + phase * taps * vec_size;
+                vec_type sum0, sum1;
+                sum0.clear();
+                sum1.clear();
+                for (unsigned int j = 0; j != taps; j += 2) {
+                    vec_type c0, c1;
+                    c0.load_aligned(c + j * vec_size);
+                    c1.load_aligned(c + (j + 1) * vec_size);
+                    sum0 += samples[j] * c0;
+                    sum1 += samples[j + 1] * c1;
+                }
+                maximum = max_(maximum, abs(sum0 + sum1));
+            }
+        }
+
+        return update(n, maximum.horizontal_max());
+    }
+    /* @} */
+
+private:
+    void compute_coefficients(double beta)
+    {
+        const double pi = 3.14159265358979323846264338327950288419716939937510;
+        const double half_length = taps / 2;
+        const double normalization = 1.0 / detail::bessel_i0(beta);
+
+        for (unsigned int phase = 0; phase != oversampling; ++phase) {
+            const double offset = double(phase) / double(oversampling);
+            double values[taps];
+            double sum = 0;
+            for (unsigned int j = 0; j != taps; ++j) {
+                const double x = double(j) - (half_length - 1) - offset;
+                const double r = x / half_length;
+                const double window = detail::bessel_i0(beta * std::sqrt(1 - r * r)) * normalization;
+                const double sinc = x == 0 ? 1 : std::sin(pi * x) / (pi * x);
+                values[j] = sinc * window;
+                sum += values[j];
+            }
+
+            for (unsigned int j = 0; j != taps; ++j) {
+                const F c = F(values[j] / sum);
+                coefficients[phase * taps + j] = c;
+                for (unsigned int lane = 0; lane != vec_type::size; ++lane)
+                    vector_coefficients[(phase * taps + j) * vec_type::size + lane] = c;
+            }
+        }
+    }
+
+    const F * fill_history(const F * in, unsigned int n)
+    {
+        assert(n <= max_block_size_);
+        std::memcpy(history.data() + taps - 1, in, n * sizeof(F));
+        return history.data();
+    }
+
+    F update(unsigned int n, F block_peak)
+    {
+        std::memmove(history.data(), history.data() + n, (taps - 1) * sizeof(F));
+        peak_ = std::max(peak_, block_peak);
+        return block_peak;
+    }
+
+    const unsigned int max_block_size_;
+    detail::aligned_buffer<F> coefficients;
+    detail::aligned_buffer<F> vector_coefficients;     /* coefficients, repeated for each lane */
+    detail::aligned_buffer<F> history;                 /* taps - 1 samples history, followed by the input */
+    F peak_;
+};
+
+} /* namespace nova */
+
+#endif /* SIMD_TRUE_PEAK_HPP */
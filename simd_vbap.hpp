@@ -0,0 +1,504 @@
+//  simd vector base amplitude panning
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef SIMD_VBAP_HPP
+#define SIMD_VBAP_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+#include "vec.hpp"
+#include "detail/aligned_buffer.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+namespace nova {
+namespace detail {
+
+/* unit vector of a direction in degrees: azimuth 0 is the front (x), 90 the left (y), elevation 90
+ * is the top (z) */
+inline void direction_vector(double azimuth, double elevation, double * out)
+{
+    const double degree = 3.14159265358979323846264338327950288419716939937510 / 180.0;
+    out[0] = std::cos(elevation * degree) * std::cos(azimuth * degree);
+    out[1] = std::cos(elevation * degree) * std::sin(azimuth * degree);
+    out[2] = std::sin(elevation * degree);
+}
+
+}
+
+/* 3d vector base amplitude panning (VBAP) of several sources to a speaker layout
+ *
+ * the speaker triplets are the faces of the convex hull of the speaker positions, faces whose plane
+ * passes through the listener are ignored (e.g. the floor of a dome). hull faces with more than 3
+ * speakers (e.g. a ring of ceiling speakers) are split into non-overlapping triplets. the gains of a source are
+ * g = L^-1 p for the triplet with the largest minimal gain, so directions outside of the layout
+ * are mapped to the closest triplet, with negative gains clipped. if all gains would be clipped, the
+ * source is panned to the nearest speaker. gains are normalized to constant power. the triplet
+ * search computes the gains of vec<F>::size triplets at once from the inverted speaker matrices,
+ * which are stored as structure of arrays.
+ *
+ * set_direction sets the target direction of a source, its gains are interpolated linearly during
+ * the next call of process, reset() jumps to the targets. process adds the panned sources to the
+ * speaker buses: out is an array of speakers buffers, in of sources buffers. only the speakers of
+ * the old and new triplet of a source are touched. process_simd requires n to be a multiple of
+ * vec<F>::size and aligned buffers.
+ */
+template <typename F>
+class vbap_panner
+{
+    typedef vec<F> vec_type;
+    static const unsigned int vec_size = vec_type::size;
+
+    vbap_panner(vbap_panner const &);
+    vbap_panner & operator=(vbap_panner const &);
+
+    struct source_gains
+    {
+        unsigned int speakers[3];
+        F gains[3];
+    };
+
+public:
+    vbap_panner(const F * azimuth, const F * elevation, unsigned int speakers, unsigned int sources):
+        speakers_(speakers), sources_(sources), positions(3 * speakers), current(sources), target(sources)
+    {
+        for (unsigned int i = 0; i != speakers; ++i)
+            detail::direction_vector(azimuth[i], elevation[i], &positions[3 * i]);
+
+        triangulate();
+        assert(triplets() > 0);
+
+        for (unsigned int source = 0; source != sources; ++source)
+            set_direction(source, F(0), F(0));
+        reset();
+    }
+
+    unsigned int speakers(void) const
+    {
+        return speakers_;
+    }
+
+    unsigned int triplets(void) const
+    {
+        return triplet_speakers.size() / 3;
+    }
+
+    void set_direction(unsigned int source, F azimuth, F elevation)
+    {
+        assert(source < sources_);
+        double direction[3];
+        detail::direction_vector(azimuth, elevation, direction);
+        compute_gains(F(direction[0]), F(direction[1]), F(direction[2]), target[source]);
+    }
+
+    /* current gain of a source for a speaker */
+    F gain(unsigned int source, unsigned int speaker) const
+    {
+        assert(source < sources_);
+        F ret = 0;
+        for (int i = 0; i != 3; ++i)
+            if (current[source].speakers[i] == speaker)
+                ret += current[source].gains[i];
+        return ret;
+    }
+
+    void reset(void)
+    {
+        current = target;
+    }
+
+    void process(F * const * out, const F * const * in, unsigned int n)
+    {
+        process_<false>(out, in, n);
+    }
+
+    void process_simd(F * const * out, const F * const * in, unsigned int n)
+    {
+        process_<true>(out, in, n);
+    }
+
+private:
+    template <bool simd>
+    void process_(F * const * out, const F * const * in, unsigned int n)
+    {
+        if (n == 0)
+            return;
+
+        for (unsigned int source = 0; source != sources_; ++source) {
+            /* gain ramps of the union of the old and new triplet */
+            unsigned int speakers[6];
+            F start[6], end[6];
+            unsigned int active = 0;
+
+            for (int i = 0; i != 3; ++i) {
+                speakers[active] = current[source].speakers[i];
+                start[active] = current[source].gains[i];
+                end[active] = F(0);
+                ++active;
+            }
+
+            for (int i = 0; i != 3; ++i) {
+                const unsigned int speaker = target[source].speakers[i];
+                unsigned int j = 0;
+                while (j != active && speakers[j] != speaker)
+                    ++j;
+                if (j == active) {
+                    speakers[active] = speaker;
+                    start[active] = end[active] = F(0);
+                    ++active;
+                }
+                end[j] += target[source].gains[i];
+            }
+
+            for (unsigned int i = 0; i != active; ++i) {
+                if (start[i] == F(0) && end[i] == F(0))
+                    continue;
+
+                const F slope = (end[i] - start[i]) / F(n);
+                if (simd)
+                    accumulate_simd(out[speakers[i]], in[source], start[i], slope, n);
+                else
+                    accumulate(out[speakers[i]], in[source], start[i], slope, n);
+            }
+
+            current[source] = target[source];
+        }
+    }
+
+    static void accumulate(F * out, const F * in, F gain, F slope, unsigned int n)
+    {
+        for (unsigned int i = 0; i != n; ++i) {
+            out[i] += in[i] * gain;
+            gain += slope;
+        }
+    }
+
+    static void accumulate_simd(F * out, const F * in, F gain, F slope, unsigned int n)
+    {
+        vec_type vgain, vslope;
+        vslope.set_vec(vgain.set_slope(gain, slope));
+
+        for (unsigned int i = 0; i != n; i += vec_size) {
+            vec_type sample, bus;
+            sample.load_aligned(in + i);
+            bus.load_aligned(out + i);
+            (bus + sample * vgain).store_aligned(out + i);
+            vgain += vslope;
+        }
+    }
+
+    /* faces of the convex hull, which do not contain the origin. hull planes with more than 3 speakers
+     * (e.g. a ring of ceiling speakers) are triangulated once, so the triplets do not overlap */
+    void triangulate(void)
+    {
+        std::vector<double> const & p = positions;
+        const double epsilon = 1e-6;
+        std::vector<double> inverses;
+        std::vector<std::vector<unsigned int> > planes;
+
+        for (unsigned int a = 0; a < speakers_; ++a) {
+            for (unsigned int b = a + 1; b < speakers_; ++b) {
+                for (unsigned int c = b + 1; c < speakers_; ++c) {
+                    const double * pa = &p[3 * a], * pb = &p[3 * b], * pc = &p[3 * c];
+                    const double u[3] = {pb[0] - pa[0], pb[1] - pa[1], pb[2] - pa[2]};
+                    const double v[3] = {pc[0] - pa[0], pc[1] - pa[1], pc[2] - pa[2]};
+                    double normal[3] = {u[1] * v[2] - u[2] * v[1],
+                                        u[2] * v[0] - u[0] * v[2],
+                                        u[0] * v[1] - u[1] * v[0]};
+                    const double length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+                    if (length < epsilon)
+                        continue;       /* degenerate */
+
+                    for (int i = 0; i != 3; ++i)
+                        normal[i] /= length;
+                    double distance = normal[0] * pa[0] + normal[1] * pa[1] + normal[2] * pa[2];
+                    if (std::abs(distance) < epsilon)
+                        continue;       /* through the origin */
+
+                    if (distance < 0) {
+                        for (int i = 0; i != 3; ++i)
+                            normal[i] = -normal[i];
+                        distance = -distance;
+                    }
+
+                    bool hull_face = true;
+                    std::vector<unsigned int> plane;
+                    for (unsigned int m = 0; m != speakers_ && hull_face; ++m) {
+                        const double * pm = &p[3 * m];
+                        const double offset = normal[0] * pm[0] + normal[1] * pm[1] + normal[2] * pm[2] - distance;
+                        if (offset > epsilon)
+                            hull_face = false;
+                        else if (offset > -epsilon)
+                            plane.push_back(m);
+                    }
+                    if (!hull_face)
+                        continue;
+
+                    if (plane.size() == 3) {
+                        add_triplet(a, b, c, inverses);
+                        continue;
+                    }
+
+                    if (std::find(planes.begin(), planes.end(), plane) != planes.end())
+                        continue;
+                    planes.push_back(plane);
+                    triangulate_plane(plane, normal, inverses);
+                }
+            }
+        }
+
+        /* structure of arrays, padded with copies of the first triplet */
+        const unsigned int count = triplets();
+        padded_triplets = (count + vec_size - 1) / vec_size * vec_size;
+        inverse_matrices.resize(9 * padded_triplets);
+        for (unsigned int t = 0; t != padded_triplets; ++t) {
+            const unsigned int source = t < count ? t : 0;
+            for (int element = 0; element != 9; ++element)
+                inverse_matrices[element * padded_triplets + t] = F(inverses[9 * source + element]);
+        }
+    }
+
+    /* greedy triangulation of coplanar speakers: the shortest edges, which neither cross an accepted
+     * edge nor pass through a speaker, are accepted, the empty triangles of the resulting edges tile the
+     * polygon of the speakers */
+    void triangulate_plane(std::vector<unsigned int> const & plane, const double * normal, std::vector<double> & inverses)
+    {
+        const double epsilon = 1e-6;
+        const unsigned int count = plane.size();
+
+        /* coordinates in the plane */
+        const double * origin = &positions[3 * plane[0]];
+        const double * first = &positions[3 * plane[1]];
+        double e0[3] = {first[0] - origin[0], first[1] - origin[1], first[2] - origin[2]};
+        const double length = std::sqrt(e0[0] * e0[0] + e0[1] * e0[1] + e0[2] * e0[2]);
+        for (int i = 0; i != 3; ++i)
+            e0[i] /= length;
+        const double e1[3] = {normal[1] * e0[2] - normal[2] * e0[1],
+                              normal[2] * e0[0] - normal[0] * e0[2],
+                              normal[0] * e0[1] - normal[1] * e0[0]};
+
+        std::vector<double> q(2 * count);
+        for (unsigned int i = 0; i != count; ++i) {
+            const double * pi = &positions[3 * plane[i]];
+            const double d[3] = {pi[0] - origin[0], pi[1] - origin[1], pi[2] - origin[2]};
+            q[2 * i]     = d[0] * e0[0] + d[1] * e0[1] + d[2] * e0[2];
+            q[2 * i + 1] = d[0] * e1[0] + d[1] * e1[1] + d[2] * e1[2];
+        }
+
+        std::vector<std::pair<double, std::pair<unsigned int, unsigned int> > > candidates;
+        for (unsigned int i = 0; i != count; ++i) {
+            for (unsigned int j = i + 1; j != count; ++j) {
+                const double dx = q[2 * j] - q[2 * i], dy = q[2 * j + 1] - q[2 * i + 1];
+                candidates.push_back(std::make_pair(dx * dx + dy * dy, std::make_pair(i, j)));
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        std::vector<char> edges(count * count, 0);
+        std::vector<std::pair<unsigned int, unsigned int> > accepted;
+        for (unsigned int e = 0; e != candidates.size(); ++e) {
+            const unsigned int i = candidates[e].second.first, j = candidates[e].second.second;
+
+            bool valid = true;
+            for (unsigned int m = 0; m != count && valid; ++m) {
+                if (m == i || m == j)
+                    continue;
+                const double dot = (q[2 * m] - q[2 * i]) * (q[2 * j] - q[2 * i])
+                                 + (q[2 * m + 1] - q[2 * i + 1]) * (q[2 * j + 1] - q[2 * i + 1]);
+                if (std::abs(orientation(&q[2 * i], &q[2 * j], &q[2 * m])) < epsilon
+                    && dot > 0 && dot < candidates[e].first)
+                    valid = false;      /* passes through a speaker */
+            }
+
+            for (unsigned int k = 0; k != accepted.size() && valid; ++k) {
+                const unsigned int r = accepted[k].first, s = accepted[k].second;
+                if (r == i || r == j || s == i || s == j)
+                    continue;
+                const double * qi = &q[2 * i], * qj = &q[2 * j], * qr = &q[2 * r], * qs = &q[2 * s];
+                if (orientation(qi, qj, qr) * orientation(qi, qj, qs) < 0
+                    && orientation(qr, qs, qi) * orientation(qr, qs, qj) < 0)
+                    valid = false;      /* crossing */
+            }
+
+            if (valid) {
+                accepted.push_back(std::make_pair(i, j));
+                edges[i * count + j] = edges[j * count + i] = 1;
+            }
+        }
+
+        for (unsigned int i = 0; i != count; ++i) {
+            for (unsigned int j = i + 1; j != count; ++j) {
+                if (!edges[i * count + j])
+                    continue;
+                for (unsigned int k = j + 1; k != count; ++k) {
+                    if (!edges[i * count + k] || !edges[j * count + k])
+                        continue;
+
+                    const double * qi = &q[2 * i], * qj = &q[2 * j], * qk = &q[2 * k];
+                    const double area = orientation(qi, qj, qk);
+                    if (std::abs(area) < epsilon)
+                        continue;
+
+                    bool empty = true;
+                    for (unsigned int m = 0; m != count && empty; ++m) {
+                        if (m == i || m == j || m == k)
+                            continue;
+                        const double * qm = &q[2 * m];
+                        if (orientation(qi, qj, qm) * area > 0 && orientation(qj, qk, qm) * area > 0
+                            && orientation(qk, qi, qm) * area > 0)
+                            empty = false;
+                    }
+                    if (empty)
+                        add_triplet(plane[i], plane[j], plane[k], inverses);
+                }
+            }
+        }
+    }
+
+    /* twice the signed area of the triangle a, b, c */
+    static double orientation(const double * a, const double * b, const double * c)
+    {
+        return (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]);
+    }
+
+    void add_triplet(unsigned int a, unsigned int b, unsigned int c, std::vector<double> & inverses)
+    {
+        const double * pa = &positions[3 * a], * pb = &positions[3 * b], * pc = &positions[3 * c];
+
+        /* rows of the inverse of the matrix with the columns a, b, c */
+        const double det = pa[0] * (pb[1] * pc[2] - pb[2] * pc[1])
+                         - pb[0] * (pa[1] * pc[2] - pa[2] * pc[1])
+                         + pc[0] * (pa[1] * pb[2] - pa[2] * pb[1]);
+        const double inverse[9] = {
+            (pb[1] * pc[2] - pb[2] * pc[1]) / det,
+            (pb[2] * pc[0] - pb[0] * pc[2]) / det,
+            (pb[0] * pc[1] - pb[1] * pc[0]) / det,
+            (pc[1] * pa[2] - pc[2] * pa[1]) / det,
+            (pc[2] * pa[0] - pc[0] * pa[2]) / det,
+            (pc[0] * pa[1] - pc[1] * pa[0]) / det,
+            (pa[1] * pb[2] - pa[2] * pb[1]) / det,
+            (pa[2] * pb[0] - pa[0] * pb[2]) / det,
+            (pa[0] * pb[1] - pa[1] * pb[0]) / det
+        };
+
+        triplet_speakers.push_back(a);
+        triplet_speakers.push_back(b);
+        triplet_speakers.push_back(c);
+        inverses.insert(inverses.end(), inverse, inverse + 9);
+    }
+
+    /* gains of the triplet with the largest minimal gain */
+    void compute_gains(F x, F y, F z, source_gains & result) const
+    {
+        const vec_type vx(x), vy(y), vz(z);
+        vec_type best_min(F(-1e30)), best_index(F(0));
+
+        const F * m = inverse_matrices.data();
+        const unsigned int stride = padded_triplets;
+        for (unsigned int t = 0; t != padded_triplets; t += vec_size) {
+            vec_type g[3];
+            for (int row = 0; row != 3; ++row) {
+                vec_type m0, m1, m2;
+                m0.load_aligned(m + (3 * row + 0) * stride + t);
+                m1.load_aligned(m + (3 * row + 1) * stride + t);
+                m2.load_aligned(m + (3 * row + 2) * stride + t);
+                g[row] = m0 * vx + m1 * vy + m2 * vz;
+            }
+
+            const vec_type minimum = min_(g[0], min_(g[1], g[2]));
+            vec_type index;
+            index.set_slope(F(t), F(1));
+
+            const vec_type better = mask_gt(minimum, best_min);
+            best_min = select(best_min, minimum, better);
+            best_index = select(best_index, index, better);
+        }
+
+        unsigned int best = 0;
+        F best_value = best_min.get(0);
+        for (unsigned int lane = 1; lane != vec_size; ++lane) {
+            if (best_min.get(lane) > best_value) {
+                best_value = best_min.get(lane);
+                best = lane;
+            }
+        }
+        const unsigned int triplet = (unsigned int)best_index.get(best);
+
+        F power = 0;
+        for (int row = 0; row != 3; ++row) {
+            const F * r = m + 3 * row * stride + triplet;
+            const F g = std::max(F(0), r[0] * x + r[stride] * y + r[2 * stride] * z);
+            result.speakers[row] = triplet_speakers[3 * triplet + row];
+            result.gains[row] = g;
+            power += g * g;
+        }
+
+        if (power == F(0)) {
+            nearest_speaker(x, y, z, result);
+            return;
+        }
+
+        const F normalization = F(1) / std::sqrt(power);
+        for (int row = 0; row != 3; ++row)
+            result.gains[row] *= normalization;
+    }
+
+    /* fallback for directions, which are far outside of all triplets */
+    void nearest_speaker(F x, F y, F z, source_gains & result) const
+    {
+        unsigned int nearest = 0;
+        F best_product = F(-2);
+        for (unsigned int speaker = 0; speaker != speakers_; ++speaker) {
+            const double * p = &positions[3 * speaker];
+            const F product = F(p[0] * x + p[1] * y + p[2] * z);
+            if (product > best_product) {
+                best_product = product;
+                nearest = speaker;
+            }
+        }
+
+        result.speakers[0] = nearest;
+        result.gains[0] = F(1);
+        for (int i = 1; i != 3; ++i) {
+            result.speakers[i] = nearest;
+            result.gains[i] = F(0);
+        }
+    }
+
+    const unsigned int speakers_, sources_;
+    std::vector<double> positions;                 /* unit vectors of the speakers */
+
+    std::vector<unsigned int> triplet_speakers;
+    detail::aligned_buffer<F> inverse_matrices;    /* element-major: 9 arrays of padded_triplets */
+    unsigned int padded_triplets;
+
+    std::vector<source_gains> current, target;
+};
+
+} /* namespace nova */
+
+#undef always_inline
+
+#endif /* SIMD_VBAP_HPP */
@@ -0,0 +1,372 @@
+//  simd wavetable oscillator bank
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef SIMD_WAVETABLE_HPP
+#define SIMD_WAVETABLE_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+#include <stdint.h>
+
+#include "vec.hpp"
+#include "detail/aligned_buffer.hpp"
+#include "detail/interpolation.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+namespace nova {
+
+/* mip-mapped, band-limited wavetable
+ *
+ * the table is built from the amplitudes of a sine series: amplitudes[h] is the amplitude of harmonic
+ * h + 1. level k of the mip map keeps the harmonics up to table_size / 2^(k+2), so the highest
+ * harmonic is sampled with at least 4 points per period. level_for_increment selects the level that
+ * is free of aliasing for a frequency given in cycles per sample.
+ *
+ * every level is stored with one guard sample before and two after the period, so 4-point
+ * interpolation does not need to wrap the table index.
+ */
+template <typename F>
+class wavetable
+{
+    wavetable(wavetable const &);
+    wavetable & operator=(wavetable const &);
+
+public:
+    wavetable(const F * amplitudes, unsigned int harmonics, unsigned int table_size = 2048):
+        table_size_(table_size)
+    {
+        assert(table_size >= 8 && (table_size & (table_size - 1)) == 0);
+
+        bits_ = 0;
+        while ((1u << bits_) != table_size)
+            ++bits_;
+
+        levels_ = bits_ - 1;
+        stride_ = (table_size + 3 + 15) & ~15u;
+        tables.resize(levels_ * stride_);
+
+        std::vector<double> sine_table(table_size);
+        for (unsigned int i = 0; i != table_size; ++i)
+            sine_table[i] = std::sin(6.28318530717958647692528676655900576839433879875021 * i / table_size);
+
+        std::vector<double> level(table_size);
+        for (unsigned int k = 0; k != levels_; ++k) {
+            const unsigned int limit = std::min(harmonics, table_size >> (k + 2));
+
+            std::fill(level.begin(), level.end(), 0.0);
+            for (unsigned int h = 1; h <= limit; ++h) {
+                const double amplitude = amplitudes[h - 1];
+                if (amplitude == 0)
+                    continue;
+                for (unsigned int i = 0; i != table_size; ++i)
+                    level[i] += amplitude * sine_table[(h * i) & (table_size - 1)];
+            }
+
+            F * table = tables.data() + k * stride_;
+            table[0] = F(level[table_size - 1]);
+            for (unsigned int i = 0; i != table_size; ++i)
+                table[i + 1] = F(level[i]);
+            table[table_size + 1] = F(level[0]);
+            table[table_size + 2] = F(level[1]);
+        }
+    }
+
+    unsigned int table_size(void) const
+    {
+        return table_size_;
+    }
+
+    unsigned int levels(void) const
+    {
+        return levels_;
+    }
+
+    /* log2(table_size) */
+    unsigned int bits(void) const
+    {
+        return bits_;
+    }
+
+    /* distance between the guarded tables of two levels */
+    unsigned int stride(void) const
+    {
+        return stride_;
+    }
+
+    unsigned int level_for_increment(F increment) const
+    {
+        /* the smallest level k with 2^(k+1) >= |increment| * table_size */
+        const F scaled = std::abs(increment) * F(table_size_);
+        unsigned int k = 0;
+        while (k + 1 < levels_ && F(2 << k) < scaled)
+            ++k;
+        return k;
+    }
+
+    /* guarded table of the given level: the period starts at index 1 */
+    const F * table(unsigned int level) const
+    {
+        return tables.data() + level * stride_;
+    }
+
+private:
+    detail::aligned_buffer<F> tables;
+    const unsigned int table_size_;
+    unsigned int bits_, levels_, stride_;
+};
+
+namespace detail {
+
+/* advance vec<F>::size fixed-point phases. index receives the guarded table index of each lane,
+ * the interpolation weight is returned */
+template <typename F, bool Vectorize = has_int_vec<vec<F> >::value>
+struct wavetable_phases
+{
+    typedef vec<F> vec_type;
+
+    static always_inline vec_type advance(uint32_t * phase, const uint32_t * increment, const int * level_offset,
+                                          int * index, unsigned int bits)
+    {
+        const int vec_size = vec_type::size;
+        const unsigned int shift = 32 - bits;
+        const uint32_t fraction_mask = (uint32_t(1) << shift) - 1;
+        const F fraction_scale = F(1) / F(uint32_t(1) << shift);
+
+        F fractions[vec_size];
+        for (int lane = 0; lane != vec_size; ++lane) {
+            const uint32_t p = phase[lane];
+            index[lane] = level_offset[lane] + int(p >> shift);
+            fractions[lane] = F(p & fraction_mask) * fraction_scale;
+            phase[lane] = p + increment[lane];
+        }
+
+        vec_type ret;
+        ret.load(fractions);
+        return ret;
+    }
+};
+
+/* phases, increments and level offsets are kept in the integer units of vec<float>. the buffers
+ * must be aligned */
+template <>
+struct wavetable_phases<float, true>
+{
+    typedef vec<float> vec_type;
+    typedef vec_type::int_vec int_vec;
+
+    static always_inline vec_type advance(uint32_t * phase, const uint32_t * increment, const int * level_offset,
+                                          int * index, unsigned int bits)
+    {
+        const int shift = 32 - bits;
+
+        vec_type phase_bits, increment_bits, offset_bits;
+        phase_bits.load_aligned(reinterpret_cast<float*>(phase));
+        increment_bits.load_aligned(reinterpret_cast<const float*>(increment));
+        offset_bits.load_aligned(reinterpret_cast<const float*>(level_offset));
+
+        const int_vec p(phase_bits);
+        vec_type(int_vec(offset_bits) + srli(p, shift)).store(reinterpret_cast<float*>(index));
+        vec_type(p + int_vec(increment_bits)).store_aligned(reinterpret_cast<float*>(phase));
+
+        /* the fraction has at most 29 bits, so the signed conversion is exact */
+        const int_vec fraction = p & int_vec(int((uint32_t(1) << shift) - 1));
+        return vec_type(fraction.convert_to_float()) * vec_type(1.f / float(uint32_t(1) << shift));
+    }
+};
+
+}
+
+/* bank of wavetable oscillators, sharing one wavetable
+ *
+ * the voices are processed in groups of vec<F>::size, one voice per lane. phases are 32-bit
+ * fixed-point accumulators (one cycle is 2^32), so they wrap without drift; the table index and the
+ * interpolation weight are derived from the upper and lower bits. if vec<F> has an integer vector
+ * type, the phases are advanced in its lanes. every lane gathers from its own mip level.
+ *
+ * frequencies are given in cycles per sample (i.e. frequency / samplerate).
+ */
+template <typename F>
+class wavetable_bank
+{
+    typedef vec<F> vec_type;
+
+    wavetable_bank(wavetable_bank const &);
+    wavetable_bank & operator=(wavetable_bank const &);
+
+public:
+    wavetable_bank(wavetable<F> const & table, unsigned int voices):
+        table_(table), voices_(voices)
+    {
+        const unsigned int vec_size = vec_type::size;
+        padded_voices = (voices + vec_size - 1) / vec_size * vec_size;
+
+        phases.resize(padded_voices);
+        increments.resize(padded_voices);
+        level_offsets.resize(padded_voices);
+        amplitudes.resize(padded_voices);
+
+        for (unsigned int voice = 0; voice != voices; ++voice)
+            amplitudes[voice] = F(1);
+    }
+
+    unsigned int voices(void) const
+    {
+        return voices_;
+    }
+
+    void set_frequency(unsigned int voice, F frequency)
+    {
+        assert(voice < voices_);
+        const double fixed = std::floor(double(frequency) * 4294967296.0 + 0.5);
+        increments[voice] = uint32_t(int64_t(fixed));
+        level_offsets[voice] = table_.level_for_increment(frequency) * table_.stride();
+    }
+
+    /* phase in cycles, [0, 1) */
+    void set_phase(unsigned int voice, F phase)
+    {
+        assert(voice < voices_);
+        const double fixed = std::floor((double(phase) - std::floor(double(phase))) * 4294967296.0);
+        phases[voice] = uint32_t(int64_t(fixed));
+    }
+
+    F phase(unsigned int voice) const
+    {
+        return F(double(phases[voice]) * (1.0 / 4294967296.0));
+    }
+
+    void set_amplitude(unsigned int voice, F amplitude)
+    {
+        assert(voice < voices_);
+        amplitudes[voice] = amplitude;
+    }
+
+    /* write n samples of voice k to outs[k] */
+    void process(F * const * outs, unsigned int n, interpolation_type type = linear_interpolation)
+    {
+        switch (type) {
+        case linear_interpolation:
+            process_<detail::linear_interpolator<F> >(outs, n);
+            return;
+
+        case hermite_interpolation:
+            process_<detail::hermite_interpolator<F> >(outs, n);
+            return;
+
+        case lagrange_interpolation:
+            process_<detail::lagrange_interpolator<F> >(outs, n);
+            return;
+        }
+    }
+
+    /* write the sum of all voices to out */
+    void process_mix(F * out, unsigned int n, interpolation_type type = linear_interpolation)
+    {
+        switch (type) {
+        case linear_interpolation:
+            process_mix_<detail::linear_interpolator<F> >(out, n);
+            return;
+
+        case hermite_interpolation:
+            process_mix_<detail::hermite_interpolator<F> >(out, n);
+            return;
+
+        case lagrange_interpolation:
+            process_mix_<detail::lagrange_interpolator<F> >(out, n);
+            return;
+        }
+    }
+
+private:
+    /* compute one sample of the voice group starting at first_voice and advance its phases */
+    template <typename Interpolator>
+    vec_type tick(unsigned int first_voice)
+    {
+        int index[vec_type::size];
+        const vec_type t = detail::wavetable_phases<F>::advance(phases.data() + first_voice,
+                                                                increments.data() + first_voice,
+                                                                level_offsets.data() + first_voice,
+                                                                index, table_.bits());
+
+        /* index addresses the guard sample before the interpolated segment */
+        const F * tables = table_.table(0);
+        vec_type ym1, y0, y1, y2;
+        y0.gather(tables + 1, index);
+        y1.gather(tables + 2, index);
+        if (Interpolator::points == 4) {
+            ym1.gather(tables, index);
+            y2.gather(tables + 3, index);
+        }
+
+        vec_type amplitude;
+        amplitude.load_aligned(amplitudes.data() + first_voice);
+        return Interpolator()(ym1, y0, y1, y2, t) * amplitude;
+    }
+
+    template <typename Interpolator>
+    void process_(F * const * outs, unsigned int n)
+    {
+        const unsigned int vec_size = vec_type::size;
+        F samples[vec_type::size];
+
+        for (unsigned int group = 0; group != padded_voices; group += vec_size) {
+            const unsigned int lanes = std::min(vec_size, voices_ - group);
+            for (unsigned int i = 0; i != n; ++i) {
+                tick<Interpolator>(group).store(samples);
+                for (unsigned int lane = 0; lane != lanes; ++lane)
+                    outs[group + lane][i] = samples[lane];
+            }
+        }
+    }
+
+    template <typename Interpolator>
+    void process_mix_(F * out, unsigned int n)
+    {
+        const unsigned int vec_size = vec_type::size;
+
+        for (unsigned int i = 0; i != n; ++i) {
+            vec_type sum;
+            sum.clear();
+            for (unsigned int group = 0; group != padded_voices; group += vec_size)
+                sum += tick<Interpolator>(group);
+            out[i] = sum.horizontal_sum();
+        }
+    }
+
+    wavetable<F> const & table_;
+    const unsigned int voices_;
+    unsigned int padded_voices;
+
+    detail::aligned_buffer<uint32_t> phases, increments;
+    detail::aligned_buffer<int> level_offsets;
+    detail::aligned_buffer<F> amplitudes;
+};
+
+} /* namespace nova */
+
+#undef always_inline
+
+#endif /* SIMD_WAVETABLE_HPP */
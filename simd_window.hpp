@@ -0,0 +1,331 @@
+//  simd window function generators
+//  Copyright (C) 2026 agent
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+//  Boston, MA 02110-1301, USA.
+
+#ifndef SIMD_WINDOW_HPP
+#define SIMD_WINDOW_HPP
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "vec.hpp"
+#include "detail/aligned_buffer.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+namespace nova {
+
+enum window_type
+{
+    rectangular_window,
+    hann_window,
+    hamming_window,
+    blackman_harris_window,     /* 4-term, -92 dB sidelobes */
+    kaiser_window,              /* parameter: beta */
+    gaussian_window             /* parameter: standard deviation, relative to half the window size */
+};
+
+namespace detail {
+
+/* the window functors are evaluated at sample index i, with period being the distance from the first
+ * sample to the (virtual) sample where the window returns to its initial value. for periodic windows
+ * (used for spectral analysis), period is the window size, for symmetric windows it is size - 1.
+ */
+
+template <typename F>
+struct rectangular_window_functor
+{
+    template <typename T>
+    always_inline T operator()(T const &) const
+    {
+        return T(F(1));
+    }
+};
+
+template <typename F>
+struct cosine_window_functor
+{
+    /* a0 - a1 * cos(x) + a2 * cos(2x) - a3 * cos(3x) */
+    cosine_window_functor(F period, F a0, F a1, F a2, F a3):
+        scale(F(6.28318530717958647692528676655900576839433879875021) / period), a0(a0), a1(a1), a2(a2), a3(a3)
+    {}
+
+    template <typename T>
+    always_inline T operator()(T const & index) const
+    {
+        T c1 = cos(index * T(scale));
+        /* chebyshev recursion for the higher harmonics */
+        T c2 = T(F(2)) * c1 * c1 - T(F(1));
+        T c3 = T(F(2)) * c1 * c2 - c1;
+
+        return T(a0) - T(a1) * c1 + T(a2) * c2 - T(a3) * c3;
+    }
+
+    const F scale, a0, a1, a2, a3;
+};
+
+template <typename F>
+struct kaiser_window_functor
+{
+    kaiser_window_functor(F period, F beta):
+        scale(F(2) / period), beta(beta)
+    {
+        /* the power series of I0 converges slowest for the largest argument */
+        double term = 1, sum = 1;
+        const double q = 0.25 * double(beta) * double(beta);
+        iterations = 0;
+        do {
+            ++iterations;
+            term *= q / (iterations * iterations);
+            sum += term;
+        } while (term > sum * std::numeric_limits<F>::epsilon());
+
+        normalization = F(1. / sum);
+    }
+
+    template <typename T>
+    always_inline T operator()(T const & index) const
+    {
+        T r = index * T(scale) - T(F(1));
+        T x = T(beta) * sqrt(max_(T(F(1)) - r * r, T(F(0))));
+
+        /* modified bessel function of the first kind I0(x) */
+        T q = x * x * T(F(0.25));
+        T term(F(1));
+        T sum(F(1));
+        for (int k = 1; k <= iterations; ++k) {
+            term = term * q * T(F(1) / F(k * k));
+            sum = sum + term;
+        }
+        return sum * T(normalization);
+    }
+
+    const F scale, beta;
+    F normalization;
+    int iterations;
+};
+
+template <typename F>
+struct gaussian_window_functor
+{
+    gaussian_window_functor(F period, F sigma):
+        scale(F(2) / period), factor(F(-0.5) / (sigma * sigma))
+    {}
+
+    template <typename T>
+    always_inline T operator()(T const & index) const
+    {
+        T r = index * T(scale) - T(F(1));
+        return exp(r * r * T(factor));
+    }
+
+    const F scale, factor;
+};
+
+template <typename F, typename Functor>
+inline void fill_window(F * out, unsigned int n, Functor const & f)
+{
+    typedef vec<F> vec_type;
+    const unsigned int vec_size = vec_type::size;
+
+    vec_type index;
+    vec_type increment(index.set_slope(F(0), F(1)));
+
+    unsigned int i = 0;
+    for (; i + vec_size <= n; i += vec_size) {
+        vec_type result = f(index);
+        result.store(out + i);
+        index += increment;
+    }
+
+    for (; i != n; ++i)
+        out[i] = f(F(i));
+}
+
+} /* namespace detail */
+
+/* compute a window of the given size
+ *
+ * periodic windows are used for spectral analysis (the first sample of the next period is omitted),
+ * symmetric windows for filter design.
+ */
+template <typename F>
+inline void make_window(F * out, window_type type, unsigned int size, F parameter = F(0), bool periodic = true)
+{
+    assert(size);
+    const F period = (periodic || size == 1) ? F(size) : F(size - 1);
+
+    switch (type)
+    {
+    case rectangular_window:
+        detail::fill_window(out, size, detail::rectangular_window_functor<F>());
+        return;
+
+    case hann_window:
+        detail::fill_window(out, size, detail::cosine_window_functor<F>(period, 0.5, 0.5, 0, 0));
+        return;
+
+    case hamming_window:
+        detail::fill_window(out, size, detail::cosine_window_functor<F>(period, 0.54, 0.46, 0, 0));
+        return;
+
+    case blackman_harris_window:
+        detail::fill_window(out, size, detail::cosine_window_functor<F>(period, 0.35875, 0.48829,
+                                                                        0.14128, 0.01168));
+        return;
+
+    case kaiser_window:
+        detail::fill_window(out, size, detail::kaiser_window_functor<F>(period, parameter));
+        return;
+
+    case gaussian_window:
+        detail::fill_window(out, size, detail::gaussian_window_functor<F>(period, parameter));
+        return;
+    }
+}
+
+/* cache for window tables
+ *
+ * tables are shared between requests for the same type, size, parameter and symmetry. the memory is
+ * cache-line aligned and zero-padded to a multiple of unroll_constraints<F>::samples_per_loop, so it
+ * can be passed directly to the _simd functions. pointers stay valid until the cache is cleared or
+ * destroyed. the cache is not thread-safe.
+ */
+template <typename F>
+class window_cache
+{
+    struct entry
+    {
+        window_type type;
+        unsigned int size;
+        F parameter;
+        bool periodic;
+        detail::aligned_buffer<F> * table;
+    };
+
+    window_cache(window_cache const &);
+    window_cache & operator=(window_cache const &);
+
+public:
+    window_cache(void)
+    {}
+
+    ~window_cache(void)
+    {
+        clear();
+    }
+
+    const F * get(window_type type, unsigned int size, F parameter = F(0), bool periodic = true)
+    {
+        for (typename std::vector<entry>::iterator it = entries.begin(); it != entries.end(); ++it) {
+            if (it->type == type && it->size == size && it->parameter == parameter && it->periodic == periodic)
+                return it->table->data();
+        }
+
+        const unsigned int samples_per_loop = vec<F>::objects_per_cacheline;
+        const unsigned int padded_size = (size + samples_per_loop - 1) / samples_per_loop * samples_per_loop;
+
+        entry e;
+        e.type = type;
+        e.size = size;
+        e.parameter = parameter;
+        e.periodic = periodic;
+        e.table = new detail::aligned_buffer<F>(padded_size);
+        make_window(e.table->data(), type, size, parameter, periodic);
+
+        try {
+            entries.push_back(e);
+        } catch (...) {
+            delete e.table;
+            throw;
+        }
+        return e.table->data();
+    }
+
+    std::size_t size(void) const
+    {
+        return entries.size();
+    }
+
+    void clear(void)
+    {
+        for (typename std::vector<entry>::iterator it = entries.begin(); it != entries.end(); ++it)
+            delete it->table;
+        entries.clear();
+    }
+
+private:
+    std::vector<entry> entries;
+};
+
+
+/* window and copy n samples of a (possibly unaligned) input to out, then clear out[n] to
+ * out[padded_size-1]. this prepares the input of a zero-padded fft in a single pass.
+ */
+template <typename F>
+inline void window_copy_vec(F * out, const F * in, const F * window, unsigned int n, unsigned int padded_size)
+{
+    assert(padded_size >= n);
+    for (unsigned int i = 0; i != n; ++i)
+        out[i] = in[i] * window[i];
+
+    for (unsigned int i = n; i != padded_size; ++i)
+        out[i] = F(0);
+}
+
+/* n and padded_size must be multiples of unroll_constraints<F>::samples_per_loop. out and window must
+ * be aligned, in can be unaligned. */
+template <typename F>
+inline void window_copy_vec_simd(F * out, const F * in, const F * window, unsigned int n, unsigned int padded_size)
+{
+    typedef vec<F> vec_type;
+    const unsigned int vec_size = vec_type::size;
+    const unsigned int per_loop = vec_type::objects_per_cacheline;
+    assert(padded_size >= n);
+
+    F * out_end = out + n;
+    while (out != out_end) {
+        for (unsigned int i = 0; i != per_loop; i += vec_size) {
+            vec_type sig, win;
+            sig.load(in + i);
+            win.load_aligned(window + i);
+            vec_type result = sig * win;
+            result.store_aligned(out + i);
+        }
+        in += per_loop;
+        window += per_loop;
+        out += per_loop;
+    }
+
+    vec_type zero;
+    zero.clear();
+    F * pad_end = out + (padded_size - n);
+    for (; out != pad_end; out += vec_size)
+        zero.store_aligned(out);
+}
+
+} /* namespace nova */
+
+#undef always_inline
+
+#endif /* SIMD_WINDOW_HPP */
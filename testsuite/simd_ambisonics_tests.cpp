@@ -0,0 +1,232 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+
+#include "../simd_ambisonics.hpp"
+#include "test_helper.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const int size = 64;
+static const unsigned int max_channels = 36;
+
+static double legendre(unsigned int l, double x)
+{
+    double p0 = 1, p1 = x;
+    if (l == 0)
+        return p0;
+    for (unsigned int k = 2; k <= l; ++k) {
+        const double p2 = ((2 * k - 1) * x * p1 - (k - 1) * p0) / k;
+        p0 = p1;
+        p1 = p2;
+    }
+    return p1;
+}
+
+template <typename float_type>
+void encode_direction(hoa_encoder<float_type> const & encoder, float_type azimuth, float_type elevation, float_type * gains)
+{
+    float_type one = 1;
+    float_type * out[max_channels];
+    for (unsigned int channel = 0; channel != encoder.channels(); ++channel)
+        out[channel] = gains + channel;
+    encoder.encode(out, &one, azimuth, elevation, 1);
+}
+
+/* sn3d addition theorem: sum_m Y_l^m(a) Y_l^m(b) = P_l(a . b) */
+template <typename float_type>
+void test_harmonics(void)
+{
+    hoa_encoder<float_type> encoder(hoa_max_order);
+    BOOST_REQUIRE_EQUAL( encoder.channels(), max_channels );
+
+    /* first order: w, y, z, x */
+    float_type gains[max_channels], other[max_channels];
+    encode_direction(encoder, float_type(0.3), float_type(0.2), gains);
+    BOOST_REQUIRE_CLOSE( gains[0], float_type(1), 1e-4 );
+    BOOST_REQUIRE_CLOSE( gains[1], float_type(cos(0.2) * sin(0.3)), 1e-4 );
+    BOOST_REQUIRE_CLOSE( gains[2], float_type(sin(0.2)), 1e-4 );
+    BOOST_REQUIRE_CLOSE( gains[3], float_type(cos(0.2) * cos(0.3)), 1e-4 );
+
+    for (int test = 0; test != 16; ++test) {
+        const float_type az_a = float_type(0.4 * test), el_a = float_type(0.1 * test - 0.7);
+        const float_type az_b = float_type(1.3 - 0.7 * test), el_b = float_type(1.1 - 0.15 * test);
+        encode_direction(encoder, az_a, el_a, gains);
+        encode_direction(encoder, az_b, el_b, other);
+
+        const double cosine = cos(el_a) * cos(el_b) * cos(az_a - az_b) + sin(el_a) * sin(el_b);
+        for (unsigned int l = 0; l <= hoa_max_order; ++l) {
+            double sum = 0;
+            for (unsigned int channel = l * l; channel != (l + 1) * (l + 1); ++channel)
+                sum += gains[channel] * other[channel];
+            BOOST_REQUIRE_SMALL( sum - legendre(l, cosine), 1e-4 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( harmonics_tests )
+{
+    test_harmonics<float>();
+    test_harmonics<double>();
+}
+
+template <typename float_type>
+void test_encoder_simd(unsigned int order)
+{
+    hoa_encoder<float_type> encoder(order);
+    const unsigned int channels = encoder.channels();
+
+    aligned_array<float_type, size> in, azimuth, elevation;
+    aligned_array<float_type, size * max_channels> out, out_simd;
+    float_type * outs[max_channels], * outs_simd[max_channels];
+    for (unsigned int channel = 0; channel != channels; ++channel) {
+        outs[channel] = out.begin() + channel * size;
+        outs_simd[channel] = out_simd.begin() + channel * size;
+    }
+
+    randomize_buffer<float_type>(in.c_array(), size);
+    for (int i = 0; i != size; ++i) {
+        azimuth[i] = float_type(-3 + 0.1 * i);
+        elevation[i] = float_type(1.5 * sin(0.3 * i));
+    }
+
+    encoder.encode(outs, in.begin(), azimuth.begin(), elevation.begin(), size);
+    encoder.encode_simd(outs_simd, in.begin(), azimuth.begin(), elevation.begin(), size);
+    for (unsigned int i = 0; i != channels * size; ++i)
+        BOOST_REQUIRE_SMALL( out[i] - out_simd[i], float_type(1e-4) );
+
+    encoder.encode(outs, in.begin(), float_type(0.5), slope_argument(float_type(-1), float_type(0.02)), size);
+    encoder.encode_simd(outs_simd, in.begin(), float_type(0.5), slope_argument(float_type(-1), float_type(0.02)), size);
+    for (unsigned int i = 0; i != channels * size; ++i)
+        BOOST_REQUIRE_SMALL( out[i] - out_simd[i], float_type(1e-4) );
+}
+
+BOOST_AUTO_TEST_CASE( encoder_tests )
+{
+    for (unsigned int order = 0; order <= hoa_max_order; ++order) {
+        test_encoder_simd<float>(order);
+        test_encoder_simd<double>(order);
+    }
+}
+
+/* rotating an encoded source is the same as encoding the rotated direction */
+template <typename float_type>
+void test_rotation(bool simd)
+{
+    const unsigned int order = 3;
+    hoa_encoder<float_type> encoder(order);
+    hoa_rotator<float_type> rotator(order);
+    const unsigned int channels = encoder.channels();
+
+    const double yaw = 0.7, pitch = -0.4, roll = 1.1;
+    rotator.set_rotation(yaw, pitch, roll);
+
+    const double azimuth = 0.9, elevation = 0.3;
+    const double p[3] = {cos(elevation) * cos(azimuth), cos(elevation) * sin(azimuth), sin(elevation)};
+
+    /* Rz(yaw) Ry(pitch) Rx(roll) p */
+    const double x1 = p[0];
+    const double y1 = cos(roll) * p[1] - sin(roll) * p[2];
+    const double z1 = sin(roll) * p[1] + cos(roll) * p[2];
+    const double x2 = cos(pitch) * x1 + sin(pitch) * z1;
+    const double z2 = -sin(pitch) * x1 + cos(pitch) * z1;
+    const double x3 = cos(yaw) * x2 - sin(yaw) * y1;
+    const double y3 = sin(yaw) * x2 + cos(yaw) * y1;
+
+    aligned_array<float_type, size> in;
+    aligned_array<float_type, size * max_channels> encoded, expected;
+    float_type * encoded_channels[max_channels], * expected_channels[max_channels];
+    for (unsigned int channel = 0; channel != channels; ++channel) {
+        encoded_channels[channel] = encoded.begin() + channel * size;
+        expected_channels[channel] = expected.begin() + channel * size;
+    }
+
+    randomize_buffer<float_type>(in.c_array(), size);
+    encoder.encode(encoded_channels, in.begin(), float_type(azimuth), float_type(elevation), size);
+    encoder.encode(expected_channels, in.begin(), float_type(atan2(y3, x3)), float_type(asin(z2)), size);
+
+    /* in place */
+    if (simd)
+        rotator.process_simd(encoded_channels, encoded_channels, size);
+    else
+        rotator.process(encoded_channels, encoded_channels, size);
+
+    for (unsigned int i = 0; i != channels * size; ++i)
+        BOOST_REQUIRE_SMALL( encoded[i] - expected[i], float_type(1e-4) );
+
+    /* blocks of different orders are not mixed */
+    BOOST_REQUIRE_EQUAL( rotator.coefficient(0, 0), float_type(1) );
+    BOOST_REQUIRE_EQUAL( rotator.coefficient(2, 5), float_type(0) );
+}
+
+BOOST_AUTO_TEST_CASE( rotation_tests )
+{
+    test_rotation<float>(false);
+    test_rotation<float>(true);
+    test_rotation<double>(false);
+    test_rotation<double>(true);
+}
+
+/* front, left, back, right, top, bottom */
+static const double octahedron_azimuth[] = {0, 1.5707963267948966, 3.141592653589793, 4.71238898038469, 0, 0};
+static const double octahedron_elevation[] = {0, 0, 0, 0, 1.5707963267948966, -1.5707963267948966};
+
+template <typename float_type>
+void test_decoder(void)
+{
+    float_type azimuth[6], elevation[6];
+    std::copy(octahedron_azimuth, octahedron_azimuth + 6, azimuth);
+    std::copy(octahedron_elevation, octahedron_elevation + 6, elevation);
+
+    hoa_encoder<float_type> encoder(1);
+    hoa_decoder<float_type> decoder(1, azimuth, elevation, 6);
+    BOOST_REQUIRE_EQUAL( decoder.speakers(), 6u );
+    BOOST_REQUIRE_EQUAL( decoder.channels(), 4u );
+    BOOST_REQUIRE_EQUAL( decoder.order(), 1u );
+
+    aligned_array<float_type, size> in;
+    aligned_array<float_type, size * 4> encoded;
+    aligned_array<float_type, size * 6> out, out_simd;
+    float_type * encoded_channels[4], * outs[6], * outs_simd[6];
+    for (unsigned int channel = 0; channel != 4; ++channel)
+        encoded_channels[channel] = encoded.begin() + channel * size;
+    for (unsigned int speaker = 0; speaker != 6; ++speaker) {
+        outs[speaker] = out.begin() + speaker * size;
+        outs_simd[speaker] = out_simd.begin() + speaker * size;
+    }
+
+    /* plane wave from the front: (1 + 3 cos(angle)) / 6 */
+    in.assign(float_type(1));
+    encoder.encode(encoded_channels, in.begin(), float_type(0), float_type(0), size);
+    decoder.process(outs, encoded_channels, size);
+    decoder.process_simd(outs_simd, encoded_channels, size);
+
+    const double expected[6] = {4.0 / 6, 1.0 / 6, -2.0 / 6, 1.0 / 6, 1.0 / 6, 1.0 / 6};
+    for (unsigned int speaker = 0; speaker != 6; ++speaker) {
+        for (int i = 0; i != size; ++i) {
+            BOOST_REQUIRE_SMALL( out[speaker * size + i] - float_type(expected[speaker]), float_type(1e-5) );
+            BOOST_REQUIRE_SMALL( out_simd[speaker * size + i] - float_type(expected[speaker]), float_type(1e-5) );
+        }
+    }
+
+    /* custom matrix */
+    decoder.set_coefficient(5, 0, float_type(0.5));
+    decoder.set_coefficient(5, 2, float_type(-0.5));
+    BOOST_REQUIRE_EQUAL( decoder.coefficient(5, 0), float_type(0.5) );
+    randomize_buffer<float_type>(encoded.c_array(), size * 4);
+    decoder.process(outs, encoded_channels, size);
+    decoder.process_simd(outs_simd, encoded_channels, size);
+    for (int i = 0; i != size * 6; ++i)
+        BOOST_REQUIRE_SMALL( out[i] - out_simd[i], float_type(1e-5) );
+}
+
+BOOST_AUTO_TEST_CASE( decoder_tests )
+{
+    test_decoder<float>();
+    test_decoder<double>();
+}
@@ -156,3 +156,127 @@ COMPARE_TEST(greater_equal)
 COMPARE_TEST(equal)
 COMPARE_TEST(notequal)
 COMPARE_TEST(clip2)
+
+template <typename float_type>
+void test_exp_ramp_argument(void)
+{
+    aligned_array<float_type, size> out, out_simd, out_mp, in0;
+    randomize_buffer<float_type>(in0.c_array(), size);
+
+    const float_type base = 0.5;
+    const float_type factor = 1.02;
+
+    times_vec(out.c_array(), in0.c_array(), exp_ramp_argument(base, factor), size);
+    times_vec_simd(out_simd.c_array(), in0.c_array(), exp_ramp_argument(base, factor), size);
+    times_vec_simd<size>(out_mp.c_array(), in0.c_array(), exp_ramp_argument(base, factor));
+
+    for (unsigned int i = 0; i != size; ++i) {
+        const float_type expected = float_type(in0[i] * base * pow(double(factor), double(i)));
+        BOOST_REQUIRE_CLOSE_FRACTION( out[i], expected, 1e-4 );
+        BOOST_REQUIRE_CLOSE_FRACTION( out_simd[i], expected, 1e-4 );
+        BOOST_REQUIRE_CLOSE_FRACTION( out_mp[i], expected, 1e-4 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( exp_ramp_argument_tests )
+{
+    test_exp_ramp_argument<float>();
+    test_exp_ramp_argument<double>();
+}
+
+template <typename float_type>
+void test_smoothed_argument(void)
+{
+    aligned_array<float_type, size> out, out_simd, out_mp, in0;
+    in0.assign(float_type(1));
+
+    const float_type current = 0.2;
+    const float_type target = 1.4;
+    const float_type coefficient = 0.05;
+
+    plus_vec(out.c_array(), smoothed_argument(current, target, coefficient), float_type(0), size);
+    plus_vec_simd(out_simd.c_array(), smoothed_argument(current, target, coefficient), float_type(0), size);
+    times_vec_simd<size>(out_mp.c_array(), in0.c_array(), smoothed_argument(current, target, coefficient));
+
+    /* one-pole lowpass of a step */
+    double state = current;
+    for (unsigned int i = 0; i != size; ++i) {
+        state += coefficient * (target - state);
+        BOOST_REQUIRE_CLOSE_FRACTION( out[i], float_type(state), 1e-5 );
+        BOOST_REQUIRE_CLOSE_FRACTION( out_simd[i], float_type(state), 1e-5 );
+        BOOST_REQUIRE_CLOSE_FRACTION( out_mp[i], float_type(state), 1e-5 );
+    }
+
+    BOOST_REQUIRE_CLOSE_FRACTION( smoothed_value(current, target, coefficient, size), float_type(state), 1e-5 );
+}
+
+BOOST_AUTO_TEST_CASE( smoothed_argument_tests )
+{
+    test_smoothed_argument<float>();
+    test_smoothed_argument<double>();
+}
+
+template <typename float_type>
+void test_interleaved_argument(unsigned int channels)
+{
+    aligned_array<float_type, size> out, out_simd, out_mp, in0;
+    aligned_array<float_type, size * 8> frames;
+    randomize_buffer<float_type>(in0.c_array(), size);
+    randomize_buffer<float_type>(frames.c_array(), size * channels);
+
+    for (unsigned int channel = 0; channel != channels; ++channel) {
+        times_vec(out.c_array(), in0.c_array(), interleaved_argument(frames.begin(), channel, channels), size);
+        times_vec_simd(out_simd.c_array(), in0.c_array(), interleaved_argument(frames.begin(), channel, channels), size);
+        times_vec_simd<size>(out_mp.c_array(), interleaved_argument(frames.begin(), channel, channels), in0.c_array());
+
+        for (unsigned int i = 0; i != size; ++i) {
+            const float_type expected = in0[i] * frames[i * channels + channel];
+            BOOST_REQUIRE_EQUAL( out[i], expected );
+            BOOST_REQUIRE_EQUAL( out_simd[i], expected );
+            BOOST_REQUIRE_EQUAL( out_mp[i], expected );
+        }
+    }
+}
+
+template <typename float_type, unsigned int channels>
+void test_static_interleaved_argument(void)
+{
+    aligned_array<float_type, size> out, out_simd, out_mp, in0;
+    aligned_array<float_type, size * 8> frames;
+    randomize_buffer<float_type>(in0.c_array(), size);
+    randomize_buffer<float_type>(frames.c_array(), size * channels);
+
+    for (unsigned int channel = 0; channel != channels; ++channel) {
+        times_vec(out.c_array(), in0.c_array(), interleaved_argument<channels>(frames.begin(), channel), size);
+        times_vec_simd(out_simd.c_array(), in0.c_array(), interleaved_argument<channels>(frames.begin(), channel), size);
+        times_vec_simd<size>(out_mp.c_array(), interleaved_argument<channels>(frames.begin(), channel), in0.c_array());
+
+        for (unsigned int i = 0; i != size; ++i) {
+            const float_type expected = in0[i] * frames[i * channels + channel];
+            BOOST_REQUIRE_EQUAL( out[i], expected );
+            BOOST_REQUIRE_EQUAL( out_simd[i], expected );
+            BOOST_REQUIRE_EQUAL( out_mp[i], expected );
+        }
+    }
+}
+
+template <typename float_type>
+void test_static_interleaved_arguments(void)
+{
+    test_static_interleaved_argument<float_type, 1>();
+    test_static_interleaved_argument<float_type, 2>();
+    test_static_interleaved_argument<float_type, 3>();
+    test_static_interleaved_argument<float_type, 4>();
+    test_static_interleaved_argument<float_type, 8>();
+}
+
+BOOST_AUTO_TEST_CASE( interleaved_argument_tests )
+{
+    for (unsigned int channels = 1; channels <= 8; ++channels) {
+        test_interleaved_argument<float>(channels);
+        test_interleaved_argument<double>(channels);
+    }
+
+    test_static_interleaved_arguments<float>();
+    test_static_interleaved_arguments<double>();
+}
@@ -0,0 +1,255 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+#include <complex>
+
+#include "../simd_complex.hpp"
+#include "test_helper.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const int size = 512;
+
+template <typename float_type>
+void test_complex_mul(void)
+{
+    aligned_array<float_type, size> a_re, a_im, b_re, b_im;
+    aligned_array<float_type, size> generic_re, generic_im, sse_re, sse_im, mp_re, mp_im;
+    randomize_buffer<float_type>(a_re.c_array(), size, -0.5);
+    randomize_buffer<float_type>(a_im.c_array(), size, -0.5);
+    randomize_buffer<float_type>(b_re.c_array(), size, -0.5);
+    randomize_buffer<float_type>(b_im.c_array(), size, -0.5);
+
+    complex_mul_vec(generic_re.c_array(), generic_im.c_array(), a_re.c_array(), a_im.c_array(),
+                    b_re.c_array(), b_im.c_array(), size);
+    complex_mul_vec_simd(sse_re.c_array(), sse_im.c_array(), a_re.c_array(), a_im.c_array(),
+                         b_re.c_array(), b_im.c_array(), size);
+    complex_mul_vec_simd<size>(mp_re.c_array(), mp_im.c_array(), a_re.c_array(), a_im.c_array(),
+                               b_re.c_array(), b_im.c_array());
+
+    for (int i = 0; i != size; ++i) {
+        complex<float_type> ref = complex<float_type>(a_re[i], a_im[i]) * complex<float_type>(b_re[i], b_im[i]);
+        BOOST_CHECK_CLOSE( generic_re[i], ref.real(), 0.01 );
+        BOOST_CHECK_CLOSE( generic_im[i], ref.imag(), 0.01 );
+        BOOST_CHECK_CLOSE( sse_re[i], generic_re[i], 0.0001 );
+        BOOST_CHECK_CLOSE( sse_im[i], generic_im[i], 0.0001 );
+        BOOST_CHECK_CLOSE( mp_re[i], generic_re[i], 0.0001 );
+        BOOST_CHECK_CLOSE( mp_im[i], generic_im[i], 0.0001 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( complex_mul_tests )
+{
+    test_complex_mul<float>();
+    test_complex_mul<double>();
+}
+
+template <typename float_type>
+void test_complex_mul_scalar(void)
+{
+    aligned_array<float_type, size> a_re, a_im;
+    aligned_array<float_type, size> generic_re, generic_im, sse_re, sse_im, mp_re, mp_im;
+    randomize_buffer<float_type>(a_re.c_array(), size, -0.5);
+    randomize_buffer<float_type>(a_im.c_array(), size, -0.5);
+
+    const float_type b_re = 0.6, b_im = -0.8;
+
+    complex_conj_mul_vec(generic_re.c_array(), generic_im.c_array(), a_re.c_array(), a_im.c_array(),
+                         b_re, b_im, size);
+    complex_conj_mul_vec_simd(sse_re.c_array(), sse_im.c_array(), a_re.c_array(), a_im.c_array(),
+                              b_re, b_im, size);
+    complex_conj_mul_vec_simd<size>(mp_re.c_array(), mp_im.c_array(), a_re.c_array(), a_im.c_array(),
+                                    b_re, b_im);
+
+    for (int i = 0; i != size; ++i) {
+        complex<float_type> ref = complex<float_type>(a_re[i], a_im[i]) * conj(complex<float_type>(b_re, b_im));
+        BOOST_CHECK_CLOSE( generic_re[i], ref.real(), 0.01 );
+        BOOST_CHECK_CLOSE( generic_im[i], ref.imag(), 0.01 );
+        BOOST_CHECK_CLOSE( sse_re[i], generic_re[i], 0.0001 );
+        BOOST_CHECK_CLOSE( sse_im[i], generic_im[i], 0.0001 );
+        BOOST_CHECK_CLOSE( mp_re[i], generic_re[i], 0.0001 );
+        BOOST_CHECK_CLOSE( mp_im[i], generic_im[i], 0.0001 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( complex_conj_mul_tests )
+{
+    test_complex_mul_scalar<float>();
+    test_complex_mul_scalar<double>();
+}
+
+template <typename float_type>
+void test_complex_madd(void)
+{
+    aligned_array<float_type, size> a_re, a_im, b_re, b_im;
+    aligned_array<float_type, size> generic_re, generic_im, sse_re, sse_im, mp_re, mp_im;
+    randomize_buffer<float_type>(a_re.c_array(), size, -0.5);
+    randomize_buffer<float_type>(a_im.c_array(), size, -0.5);
+    randomize_buffer<float_type>(b_re.c_array(), size, -0.5);
+    randomize_buffer<float_type>(b_im.c_array(), size, -0.5);
+    randomize_buffer<float_type>(generic_re.c_array(), size, 2);
+    randomize_buffer<float_type>(generic_im.c_array(), size, 2);
+
+    for (int i = 0; i != size; ++i) {
+        sse_re[i] = mp_re[i] = generic_re[i];
+        sse_im[i] = mp_im[i] = generic_im[i];
+    }
+
+    aligned_array<float_type, size> acc_re = generic_re, acc_im = generic_im;
+
+    /* accumulate in-place */
+    complex_madd_vec(generic_re.c_array(), generic_im.c_array(), a_re.c_array(), a_im.c_array(),
+                     b_re.c_array(), b_im.c_array(), generic_re.c_array(), generic_im.c_array(), size);
+    complex_madd_vec_simd(sse_re.c_array(), sse_im.c_array(), a_re.c_array(), a_im.c_array(),
+                          b_re.c_array(), b_im.c_array(), sse_re.c_array(), sse_im.c_array(), size);
+    complex_madd_vec_simd<size>(mp_re.c_array(), mp_im.c_array(), a_re.c_array(), a_im.c_array(),
+                                b_re.c_array(), b_im.c_array(), mp_re.c_array(), mp_im.c_array());
+
+    for (int i = 0; i != size; ++i) {
+        complex<float_type> ref = complex<float_type>(a_re[i], a_im[i]) * complex<float_type>(b_re[i], b_im[i])
+                                  + complex<float_type>(acc_re[i], acc_im[i]);
+        BOOST_CHECK_CLOSE( generic_re[i], ref.real(), 0.01 );
+        BOOST_CHECK_CLOSE( generic_im[i], ref.imag(), 0.01 );
+        BOOST_CHECK_CLOSE( sse_re[i], generic_re[i], 0.0001 );
+        BOOST_CHECK_CLOSE( sse_im[i], generic_im[i], 0.0001 );
+        BOOST_CHECK_CLOSE( mp_re[i], generic_re[i], 0.0001 );
+        BOOST_CHECK_CLOSE( mp_im[i], generic_im[i], 0.0001 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( complex_madd_tests )
+{
+    test_complex_madd<float>();
+    test_complex_madd<double>();
+}
+
+template <typename float_type>
+void test_complex_mag_squared(void)
+{
+    aligned_array<float_type, size> re, im, generic, sseval, mpval;
+    randomize_buffer<float_type>(re.c_array(), size, -0.5);
+    randomize_buffer<float_type>(im.c_array(), size, -0.5);
+
+    complex_mag_squared_vec(generic.c_array(), re.c_array(), im.c_array(), size);
+    complex_mag_squared_vec_simd(sseval.c_array(), re.c_array(), im.c_array(), size);
+    complex_mag_squared_vec_simd<size>(mpval.c_array(), re.c_array(), im.c_array());
+
+    for (int i = 0; i != size; ++i) {
+        BOOST_CHECK_CLOSE( generic[i], norm(complex<float_type>(re[i], im[i])), 0.01 );
+        BOOST_CHECK_CLOSE( sseval[i], generic[i], 0.0001 );
+        BOOST_CHECK_CLOSE( mpval[i], generic[i], 0.0001 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( complex_mag_squared_tests )
+{
+    test_complex_mag_squared<float>();
+    test_complex_mag_squared<double>();
+}
+
+template <typename float_type>
+void test_car2pol(void)
+{
+    aligned_array<float_type, size> re, im;
+    aligned_array<float_type, size> generic_mag, generic_phase, sse_mag, sse_phase, mp_mag, mp_phase;
+    aligned_array<float_type, size> fast_mag, fast_phase;
+    randomize_buffer<float_type>(re.c_array(), size, 2, -1);
+    randomize_buffer<float_type>(im.c_array(), size, 2, -1);
+
+    car2pol_vec(generic_mag.c_array(), generic_phase.c_array(), re.c_array(), im.c_array(), size);
+    car2pol_vec_simd(sse_mag.c_array(), sse_phase.c_array(), re.c_array(), im.c_array(), size);
+    car2pol_vec_simd<size>(mp_mag.c_array(), mp_phase.c_array(), re.c_array(), im.c_array());
+    car2pol_fast_vec_simd(fast_mag.c_array(), fast_phase.c_array(), re.c_array(), im.c_array(), size);
+
+    for (int i = 0; i != size; ++i) {
+        BOOST_CHECK_CLOSE( generic_mag[i], abs(complex<float_type>(re[i], im[i])), 0.01 );
+        BOOST_CHECK_SMALL( generic_phase[i] - atan2(im[i], re[i]), float_type(1e-5) );
+
+        BOOST_CHECK_CLOSE( sse_mag[i], generic_mag[i], 0.0001 );
+        BOOST_CHECK_CLOSE( mp_mag[i], generic_mag[i], 0.0001 );
+        BOOST_CHECK_CLOSE( fast_mag[i], generic_mag[i], 0.0001 );
+
+        BOOST_CHECK_SMALL( sse_phase[i] - generic_phase[i], float_type(1e-5) );
+        BOOST_CHECK_SMALL( mp_phase[i] - generic_phase[i], float_type(1e-5) );
+        BOOST_CHECK_SMALL( fast_phase[i] - generic_phase[i], float_type(2e-5) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( car2pol_tests )
+{
+    test_car2pol<float>();
+    test_car2pol<double>();
+}
+
+/* signed zeros follow std::atan2 */
+template <typename float_type>
+void test_car2pol_signed_zero(void)
+{
+    const float_type zero = 0;
+    const float_type cases[][2] = {
+        { zero,  zero}, { zero, -zero}, {-zero,  zero}, {-zero, -zero},
+        { 1,     zero}, { 1,    -zero}, {-1,     zero}, {-1,    -zero},
+        { zero,  1},    {-zero,  1},    { zero, -1},    {-zero, -1}
+    };
+    const int count = sizeof(cases) / sizeof(cases[0]);
+
+    aligned_array<float_type, size> re, im;
+    aligned_array<float_type, size> generic_mag, generic_phase, sse_mag, sse_phase, fast_mag, fast_phase;
+    for (int i = 0; i != size; ++i) {
+        re[i] = cases[i % count][0];
+        im[i] = cases[i % count][1];
+    }
+
+    car2pol_vec(generic_mag.c_array(), generic_phase.c_array(), re.c_array(), im.c_array(), size);
+    car2pol_vec_simd(sse_mag.c_array(), sse_phase.c_array(), re.c_array(), im.c_array(), size);
+    car2pol_fast_vec_simd(fast_mag.c_array(), fast_phase.c_array(), re.c_array(), im.c_array(), size);
+
+    for (int i = 0; i != size; ++i) {
+        const float_type expected = atan2(im[i], re[i]);
+        BOOST_REQUIRE_SMALL( generic_phase[i] - expected, float_type(1e-5) );
+        BOOST_REQUIRE_SMALL( sse_phase[i] - expected, float_type(1e-5) );
+        BOOST_REQUIRE_SMALL( fast_phase[i] - expected, float_type(2e-5) );
+        BOOST_REQUIRE_EQUAL( (bool)signbit(sse_phase[i]), (bool)signbit(expected) );
+        BOOST_REQUIRE_EQUAL( (bool)signbit(fast_phase[i]), (bool)signbit(expected) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( car2pol_signed_zero_tests )
+{
+    test_car2pol_signed_zero<float>();
+    test_car2pol_signed_zero<double>();
+}
+
+template <typename float_type>
+void test_pol2car(void)
+{
+    aligned_array<float_type, size> mag, phase;
+    aligned_array<float_type, size> generic_re, generic_im, sse_re, sse_im, mp_re, mp_im;
+    randomize_buffer<float_type>(mag.c_array(), size);
+    randomize_buffer<float_type>(phase.c_array(), size, 6, -3);
+
+    pol2car_vec(generic_re.c_array(), generic_im.c_array(), mag.c_array(), phase.c_array(), size);
+    pol2car_vec_simd(sse_re.c_array(), sse_im.c_array(), mag.c_array(), phase.c_array(), size);
+    pol2car_vec_simd<size>(mp_re.c_array(), mp_im.c_array(), mag.c_array(), phase.c_array());
+
+    for (int i = 0; i != size; ++i) {
+        complex<float_type> ref = polar(mag[i], phase[i]);
+        BOOST_CHECK_SMALL( generic_re[i] - ref.real(), float_type(1e-5) );
+        BOOST_CHECK_SMALL( generic_im[i] - ref.imag(), float_type(1e-5) );
+        BOOST_CHECK_SMALL( sse_re[i] - generic_re[i], float_type(1e-5) );
+        BOOST_CHECK_SMALL( sse_im[i] - generic_im[i], float_type(1e-5) );
+        BOOST_CHECK_SMALL( mp_re[i] - generic_re[i], float_type(1e-5) );
+        BOOST_CHECK_SMALL( mp_im[i] - generic_im[i], float_type(1e-5) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( pol2car_tests )
+{
+    test_pol2car<float>();
+    test_pol2car<double>();
+}
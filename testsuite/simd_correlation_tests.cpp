@@ -0,0 +1,116 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+
+#include "../simd_correlation.hpp"
+#include "test_helper.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const unsigned int size = 256;
+static const unsigned int max_lags = 67;
+
+template <typename float_type>
+void test_dot(void)
+{
+    aligned_array<float_type, size> in0, in1;
+    randomize_buffer<float_type>(in0.c_array(), size);
+    randomize_buffer<float_type>(in1.c_array(), size);
+
+    for (unsigned int n = 0; n <= size; n += 8) {
+        double expected = 0;
+        for (unsigned int i = 0; i != n; ++i)
+            expected += double(in0[i]) * in1[i];
+
+        BOOST_REQUIRE_SMALL( dot_vec(in0.begin(), in1.begin(), n) - expected, 1e-4 );
+        BOOST_REQUIRE_SMALL( dot_vec_simd(in0.begin(), in1.begin(), n) - expected, 1e-4 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( dot_tests )
+{
+    test_dot<float>();
+    test_dot<double>();
+}
+
+template <typename float_type>
+void test_cross_correlation(unsigned int lags)
+{
+    aligned_array<float_type, size> in0;
+    aligned_array<float_type, size + max_lags> in1;
+    aligned_array<float_type, max_lags> out, out_simd;
+    randomize_buffer<float_type>(in0.c_array(), size);
+    randomize_buffer<float_type>(in1.c_array(), size + max_lags);
+
+    cross_correlation_vec(out.begin(), in0.begin(), in1.begin(), size, lags);
+    cross_correlation_vec_simd(out_simd.begin(), in0.begin(), in1.begin(), size, lags);
+
+    for (unsigned int lag = 0; lag != lags; ++lag) {
+        double expected = 0;
+        for (unsigned int i = 0; i != size; ++i)
+            expected += double(in0[i]) * in1[i + lag];
+
+        BOOST_REQUIRE_SMALL( out[lag] - expected, 1e-4 );
+        BOOST_REQUIRE_SMALL( out_simd[lag] - expected, 1e-4 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( cross_correlation_tests )
+{
+    for (unsigned int lags = 1; lags <= max_lags; lags += 11) {
+        test_cross_correlation<float>(lags);
+        test_cross_correlation<double>(lags);
+    }
+}
+
+/* a delayed copy peaks at the delay */
+BOOST_AUTO_TEST_CASE( time_delay_tests )
+{
+    const unsigned int delay = 23;
+    aligned_array<float, size> reference;
+    aligned_array<float, size + max_lags> delayed;
+    aligned_array<float, max_lags> out;
+    randomize_buffer<float>(reference.c_array(), size);
+    delayed.assign(0);
+    for (unsigned int i = 0; i != size; ++i)
+        delayed[i + delay] = reference[i];
+
+    cross_correlation_vec_simd(out.begin(), reference.begin(), delayed.begin(), size, max_lags);
+    BOOST_REQUIRE_EQUAL( std::max_element(out.begin(), out.end()) - out.begin(), int(delay) );
+}
+
+template <typename float_type>
+void test_autocorrelation(unsigned int n, unsigned int lags)
+{
+    aligned_array<float_type, size> in;
+    aligned_array<float_type, max_lags> out, out_simd;
+    randomize_buffer<float_type>(in.c_array(), size);
+
+    autocorrelation_vec(out.begin(), in.begin(), n, lags);
+    autocorrelation_vec_simd(out_simd.begin(), in.begin(), n, lags);
+
+    for (unsigned int lag = 0; lag != lags; ++lag) {
+        double expected = 0;
+        for (unsigned int i = 0; i + lag < n; ++i)
+            expected += double(in[i]) * in[i + lag];
+
+        BOOST_REQUIRE_SMALL( out[lag] - expected, 1e-4 );
+        BOOST_REQUIRE_SMALL( out_simd[lag] - expected, 1e-4 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( autocorrelation_tests )
+{
+    const unsigned int lengths[] = {size, 131, 67, 9};
+    for (int length = 0; length != 4; ++length) {
+        for (unsigned int lags = 1; lags <= std::min(lengths[length], max_lags); lags += 5) {
+            test_autocorrelation<float>(lengths[length], lags);
+            test_autocorrelation<double>(lengths[length], lags);
+        }
+    }
+}
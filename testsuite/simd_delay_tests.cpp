@@ -0,0 +1,165 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+
+#include "../simd_delay.hpp"
+#include "test_helper.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const int size = 64;
+static const int max_delay = 100;
+static const int blocks = 20;
+
+static const interpolation_type interpolation_types[] = {
+    linear_interpolation, hermite_interpolation, lagrange_interpolation
+};
+
+/* all interpolators reproduce a linear signal exactly */
+template <typename float_type>
+void test_delay_ramp(void)
+{
+    aligned_array<float_type, size> in, generic, simd, modulated, delays;
+    const float_type delay = 17.25;
+
+    for (int type_index = 0; type_index != 3; ++type_index) {
+        const interpolation_type type = interpolation_types[type_index];
+        delay_line<float_type> line(max_delay, size);
+
+        for (int block = 0; block != blocks; ++block) {
+            for (int i = 0; i != size; ++i) {
+                in[i] = float_type(block * size + i) * float_type(0.01);
+                delays[i] = delay;
+            }
+
+            line.write(in.c_array(), size);
+            line.read(generic.c_array(), delay, size, type);
+            line.read_simd(simd.c_array(), delay, size, type);
+            line.read_simd(modulated.c_array(), delays.c_array(), size, type);
+
+            if (block < 2)
+                continue;
+
+            for (int i = 0; i != size; ++i) {
+                float_type expected = (float_type(block * size + i) - delay) * float_type(0.01);
+                BOOST_CHECK_CLOSE( generic[i], expected, 0.01 );
+                BOOST_CHECK_CLOSE( simd[i], generic[i], 0.0001 );
+                BOOST_CHECK_CLOSE( modulated[i], generic[i], 0.0001 );
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( delay_ramp_tests )
+{
+    test_delay_ramp<float>();
+    test_delay_ramp<double>();
+}
+
+template <typename float_type>
+void test_delay_modulated(void)
+{
+    aligned_array<float_type, size> in, delays, generic, simd;
+    aligned_array<float_type, size * blocks> history;
+
+    for (int type_index = 0; type_index != 3; ++type_index) {
+        const interpolation_type type = interpolation_types[type_index];
+        delay_line<float_type> line(max_delay, size);
+
+        for (int block = 0; block != blocks; ++block) {
+            randomize_buffer<float_type>(in.c_array(), size, 2, -1);
+            randomize_buffer<float_type>(delays.c_array(), size, max_delay - 1, 1);
+            for (int i = 0; i != size; ++i)
+                history[block * size + i] = in[i];
+
+            line.write(in.c_array(), size);
+            line.read(generic.c_array(), delays.c_array(), size, type);
+            line.read_simd(simd.c_array(), delays.c_array(), size, type);
+
+            for (int i = 0; i != size; ++i) {
+                BOOST_CHECK_SMALL( simd[i] - generic[i], float_type(1e-5) );
+
+                if (type == linear_interpolation && block > 2) {
+                    const int position = block * size + i;
+                    const int integer_part = int(floor(delays[i]));
+                    const float_type t = delays[i] - integer_part;
+                    const float_type y0 = history[position - integer_part];
+                    const float_type y1 = history[position - integer_part - 1];
+                    BOOST_CHECK_SMALL( generic[i] - (y0 + t * (y1 - y0)), float_type(1e-5) );
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( delay_modulated_tests )
+{
+    test_delay_modulated<float>();
+    test_delay_modulated<double>();
+}
+
+template <typename float_type>
+void test_delay_slope(void)
+{
+    aligned_array<float_type, size> in, generic, simd;
+
+    delay_line<float_type> line(max_delay, size);
+    float_type delay = 1;
+    const float_type slope = 0.01;
+
+    for (int block = 0; block != blocks; ++block) {
+        randomize_buffer<float_type>(in.c_array(), size, 2, -1);
+        line.write(in.c_array(), size);
+        line.read(generic.c_array(), slope_argument(delay, slope), size, hermite_interpolation);
+        line.read_simd(simd.c_array(), slope_argument(delay, slope), size, hermite_interpolation);
+        delay += slope * size;
+
+        for (int i = 0; i != size; ++i)
+            BOOST_CHECK_SMALL( simd[i] - generic[i], float_type(1e-4) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( delay_slope_tests )
+{
+    test_delay_slope<float>();
+    test_delay_slope<double>();
+}
+
+template <typename float_type>
+void test_delay_taps(void)
+{
+    static const int taps = 3;
+    const float_type delays[taps] = { 1.5, 33, 99.75 };
+
+    aligned_array<float_type, size> in, reference;
+    aligned_array<float_type, size> tap0, tap1, tap2;
+    float_type * outs[taps] = { tap0.c_array(), tap1.c_array(), tap2.c_array() };
+
+    for (int type_index = 0; type_index != 3; ++type_index) {
+        const interpolation_type type = interpolation_types[type_index];
+        delay_line<float_type> line(max_delay, size);
+
+        for (int block = 0; block != blocks; ++block) {
+            randomize_buffer<float_type>(in.c_array(), size, 2, -1);
+            line.write(in.c_array(), size);
+            line.read_taps_simd(outs, delays, taps, size, type);
+
+            for (int tap = 0; tap != taps; ++tap) {
+                line.read(reference.c_array(), delays[tap], size, type);
+                for (int i = 0; i != size; ++i)
+                    BOOST_CHECK_SMALL( outs[tap][i] - reference[i], float_type(1e-5) );
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( delay_taps_tests )
+{
+    test_delay_taps<float>();
+    test_delay_taps<double>();
+}
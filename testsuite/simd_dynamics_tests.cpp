@@ -0,0 +1,173 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "../simd_dynamics.hpp"
+#include "test_helper.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const int size = 64;
+static const double two_pi = 6.283185307179586476925286766559;
+
+/* reference gain computer in the dB domain */
+static double reference_gain(double level, double threshold, double ratio, double knee)
+{
+    const double over = 20 * log10(level) - threshold;
+    double reduction = 0;
+    if (2 * over > knee)
+        reduction = (1 / ratio - 1) * over;
+    else if (2 * over > -knee)
+        reduction = (1 / ratio - 1) * (over + knee / 2) * (over + knee / 2) / (2 * knee);
+    return pow(10, reduction / 20);
+}
+
+template <typename float_type>
+void test_compressor_gain(float_type knee)
+{
+    const float_type threshold = -20;
+    const float_type ratio = 4;
+    aligned_array<float_type, size> level, generic, simd;
+    for (int i = 0; i != size; ++i)
+        level[i] = float_type(pow(10.0, (-40 + i * 0.625) / 20));
+
+    compressor_gain_vec(generic.c_array(), level.c_array(), threshold, ratio, knee, size);
+    compressor_gain_vec_simd(simd.c_array(), level.c_array(), threshold, ratio, knee, size);
+
+    for (int i = 0; i != size; ++i) {
+        const double expected = reference_gain(level[i], threshold, ratio, knee);
+        BOOST_REQUIRE_CLOSE( generic[i], expected, 1e-2 );
+        BOOST_REQUIRE_CLOSE( simd[i], expected, 1e-2 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( compressor_gain_tests )
+{
+    test_compressor_gain<float>(0);
+    test_compressor_gain<float>(10);
+    test_compressor_gain<double>(0);
+    test_compressor_gain<double>(10);
+}
+
+/* the output never exceeds the ceiling, generic and simd versions match */
+template <typename float_type>
+void test_limiter_ceiling(void)
+{
+    const int channels = 2;
+    const int blocks = 64;
+    const float_type ceiling = float_type(0.5);
+
+    aligned_array<float_type, size * channels> input, generic, simd;
+    const float_type * in[channels];
+    float_type * generic_out[channels], * simd_out[channels];
+    for (int channel = 0; channel != channels; ++channel) {
+        in[channel] = input.c_array() + channel * size;
+        generic_out[channel] = generic.c_array() + channel * size;
+        simd_out[channel] = simd.c_array() + channel * size;
+    }
+
+    lookahead_limiter<float_type> generic_limiter(channels, 32), simd_limiter(channels, 32);
+    generic_limiter.set_ceiling(ceiling);
+    simd_limiter.set_ceiling(ceiling);
+    generic_limiter.set_release_time(200);
+    simd_limiter.set_release_time(200);
+
+    for (int block = 0; block != blocks; ++block) {
+        for (int i = 0; i != size; ++i) {
+            const int index = block * size + i;
+            const double amplitude = 0.2 + 1.8 * ((index / 300) % 3) / 2;
+            input[i] = float_type(amplitude * sin(two_pi * 0.01 * index));
+            input[size + i] = float_type(0.3 * sin(two_pi * 0.037 * index));
+        }
+
+        generic_limiter.process(generic_out, in, size);
+        simd_limiter.process_simd(simd_out, in, size);
+
+        for (int channel = 0; channel != channels; ++channel) {
+            for (int i = 0; i != size; ++i) {
+                BOOST_REQUIRE_SMALL( generic_out[channel][i] - simd_out[channel][i], float_type(1e-5) );
+                BOOST_REQUIRE_LE( abs(simd_out[channel][i]), ceiling * float_type(1.0001) );
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( limiter_ceiling_tests )
+{
+    test_limiter_ceiling<float>();
+    test_limiter_ceiling<double>();
+}
+
+/* below the ceiling, the output is the delayed input */
+template <typename float_type>
+void test_limiter_latency(void)
+{
+    const int lookahead = 21;
+    aligned_array<float_type, size> input, output;
+    const float_type * in[1] = {input.c_array()};
+    float_type * out[1] = {output.c_array()};
+
+    lookahead_limiter<float_type> limiter(1, lookahead);
+    BOOST_REQUIRE_EQUAL( limiter.latency(), unsigned(lookahead) );
+
+    for (int block = 0; block != 4; ++block) {
+        for (int i = 0; i != size; ++i)
+            input[i] = float_type(0.9 * sin(two_pi * 0.02 * (block * size + i)));
+
+        limiter.process_simd(out, in, size);
+
+        for (int i = 0; i != size; ++i) {
+            const int delayed = block * size + i - lookahead;
+            const double expected = delayed < 0 ? 0 : 0.9 * sin(two_pi * 0.02 * delayed);
+            BOOST_REQUIRE_SMALL( output[i] - expected, 1e-5 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( limiter_latency_tests )
+{
+    test_limiter_latency<float>();
+    test_limiter_latency<double>();
+}
+
+/* a peak in one channel reduces the gain of all channels */
+template <typename float_type>
+void test_limiter_linked(void)
+{
+    const int channels = 3;
+    const int lookahead = 8;
+    aligned_array<float_type, size * channels> input, output;
+    const float_type * in[channels];
+    float_type * out[channels];
+    for (int channel = 0; channel != channels; ++channel) {
+        in[channel] = input.c_array() + channel * size;
+        out[channel] = output.c_array() + channel * size;
+    }
+
+    for (int channel = 0; channel != channels; ++channel)
+        for (int i = 0; i != size; ++i)
+            input[channel * size + i] = float_type(0.25);
+    input[size + 20] = 2;
+
+    lookahead_limiter<float_type> limiter(channels, lookahead);
+    limiter.set_release(float_type(0.99));
+    limiter.process_simd(out, in, size);
+
+    /* the peak is delayed to 28 and scaled by 1/2 */
+    BOOST_REQUIRE_CLOSE( output[size + 28], float_type(1), 1e-3 );
+    BOOST_REQUIRE_CLOSE( output[28], float_type(0.125), 1e-3 );
+    BOOST_REQUIRE_CLOSE( output[2 * size + 28], float_type(0.125), 1e-3 );
+    BOOST_REQUIRE_LT( limiter.gain(), float_type(1) );
+}
+
+BOOST_AUTO_TEST_CASE( limiter_linked_tests )
+{
+    test_limiter_linked<float>();
+    test_limiter_linked<double>();
+}
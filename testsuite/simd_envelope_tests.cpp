@@ -0,0 +1,143 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "../simd_envelope.hpp"
+#include "test_helper.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const int size = 64;
+static const int channels = 5;
+
+template <typename float_type>
+void test_step(envelope_detection detection)
+{
+    aligned_array<float_type, size * channels> input, generic, simd;
+    const float_type * in[channels];
+    float_type * generic_out[channels], * simd_out[channels];
+    for (int channel = 0; channel != channels; ++channel) {
+        in[channel] = input.c_array() + channel * size;
+        generic_out[channel] = generic.c_array() + channel * size;
+        simd_out[channel] = simd.c_array() + channel * size;
+    }
+
+    envelope_follower_bank<float_type> generic_bank(channels, detection), simd_bank(channels, detection);
+    for (int channel = 0; channel != channels; ++channel) {
+        const float_type attack = float_type(0.5 + 0.1 * channel);
+        const float_type release = float_type(0.9 + 0.01 * channel);
+        generic_bank.set_attack(channel, attack);
+        generic_bank.set_release(channel, release);
+        simd_bank.set_attack(channel, attack);
+        simd_bank.set_release(channel, release);
+    }
+    generic_bank.reset();
+    simd_bank.reset();
+
+    /* attack: step from 0 to +-1 */
+    for (int channel = 0; channel != channels; ++channel)
+        for (int i = 0; i != size; ++i)
+            input[channel * size + i] = (i & 1) ? 1 : -1;
+
+    generic_bank.process(generic_out, in, size);
+    simd_bank.process_simd(simd_out, in, size);
+
+    for (int channel = 0; channel != channels; ++channel) {
+        const double attack = 0.5 + 0.1 * channel;
+        for (int i = 0; i != size; ++i) {
+            BOOST_REQUIRE_SMALL( generic_out[channel][i] - simd_out[channel][i], float_type(1e-6) );
+
+            double expected = 1 - pow(attack, i + 1);
+            if (detection == rms_detection)
+                expected = sqrt(expected);
+            BOOST_REQUIRE_SMALL( simd_out[channel][i] - expected, 1e-4 );
+        }
+    }
+
+    /* release: decay to 0 */
+    for (int i = 0; i != size * channels; ++i)
+        input[i] = 0;
+
+    const float_type start[channels] = { simd_bank.value(0), simd_bank.value(1), simd_bank.value(2),
+                                         simd_bank.value(3), simd_bank.value(4) };
+    generic_bank.process(generic_out, in, size);
+    simd_bank.process_simd(simd_out, in, size);
+
+    for (int channel = 0; channel != channels; ++channel) {
+        const double release = 0.9 + 0.01 * channel;
+        for (int i = 0; i != size; ++i) {
+            BOOST_REQUIRE_SMALL( generic_out[channel][i] - simd_out[channel][i], float_type(1e-6) );
+
+            double expected = (detection == rms_detection) ? start[channel] * start[channel] : start[channel];
+            expected *= pow(release, i + 1);
+            if (detection == rms_detection)
+                expected = sqrt(expected);
+            BOOST_REQUIRE_SMALL( simd_out[channel][i] - expected, 1e-4 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( envelope_step_tests )
+{
+    test_step<float>(peak_detection);
+    test_step<double>(peak_detection);
+    test_step<float>(rms_detection);
+    test_step<double>(rms_detection);
+}
+
+/* coefficients are ramped linearly over the block */
+template <typename float_type>
+void test_ramp(void)
+{
+    aligned_array<float_type, size * channels> input, generic, simd;
+    const float_type * in[channels];
+    float_type * generic_out[channels], * simd_out[channels];
+    for (int channel = 0; channel != channels; ++channel) {
+        in[channel] = input.c_array() + channel * size;
+        generic_out[channel] = generic.c_array() + channel * size;
+        simd_out[channel] = simd.c_array() + channel * size;
+    }
+    randomize_buffer<float_type>(input.c_array(), size * channels, 2, -1);
+
+    envelope_follower_bank<float_type> generic_bank(channels), simd_bank(channels);
+    for (int channel = 0; channel != channels; ++channel) {
+        generic_bank.set_attack_time(channel, 10);
+        generic_bank.set_release_time(channel, 100);
+        simd_bank.set_attack_time(channel, 10);
+        simd_bank.set_release_time(channel, 100);
+    }
+    generic_bank.reset();
+    simd_bank.reset();
+
+    for (int block = 0; block != 8; ++block) {
+        for (int channel = 0; channel != channels; ++channel) {
+            generic_bank.set_attack_time(channel, float_type(1 + block + channel));
+            simd_bank.set_attack_time(channel, float_type(1 + block + channel));
+            generic_bank.set_release(channel, float_type(0.5 + 0.05 * block));
+            simd_bank.set_release(channel, float_type(0.5 + 0.05 * block));
+        }
+
+        generic_bank.process(generic_out, in, size);
+        simd_bank.process_simd(simd_out, in, size);
+
+        for (int i = 0; i != size * channels; ++i) {
+            BOOST_REQUIRE_SMALL( generic[i] - simd[i], float_type(1e-5) );
+            BOOST_REQUIRE( simd[i] >= 0 && simd[i] <= 1 );
+        }
+    }
+
+    BOOST_CHECK_CLOSE( float_type(envelope_follower_bank<float_type>::time_to_coefficient(10)),
+                       float_type(exp(-0.1)), 0.0001 );
+}
+
+BOOST_AUTO_TEST_CASE( envelope_ramp_tests )
+{
+    test_ramp<float>();
+    test_ramp<double>();
+}
@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include "../simd_interleave.hpp"
+#include "test_helper.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const int size = 64;
+static const int max_channels = 8;
+
+template <typename float_type>
+void test_interleave(unsigned int channels)
+{
+    aligned_array<float_type, size * max_channels> planar, generic_planar, simd_planar;
+    aligned_array<float_type, size * max_channels> generic, simd;
+    randomize_buffer<float_type>(planar.c_array(), size * max_channels);
+
+    const float_type * in[max_channels];
+    float_type * generic_out[max_channels], * simd_out[max_channels];
+    for (unsigned int channel = 0; channel != max_channels; ++channel) {
+        in[channel] = planar.c_array() + channel * size;
+        generic_out[channel] = generic_planar.c_array() + channel * size;
+        simd_out[channel] = simd_planar.c_array() + channel * size;
+    }
+
+    interleave_vec(generic.c_array(), in, channels, size);
+    interleave_vec_simd(simd.c_array(), in, channels, size);
+
+    for (int i = 0; i != size; ++i) {
+        for (unsigned int channel = 0; channel != channels; ++channel) {
+            BOOST_REQUIRE_EQUAL( generic[i * channels + channel], in[channel][i] );
+            BOOST_REQUIRE_EQUAL( simd[i * channels + channel], in[channel][i] );
+        }
+    }
+
+    deinterleave_vec(generic_out, generic.c_array(), channels, size);
+    deinterleave_vec_simd(simd_out, simd.c_array(), channels, size);
+
+    for (unsigned int channel = 0; channel != channels; ++channel) {
+        for (int i = 0; i != size; ++i) {
+            BOOST_REQUIRE_EQUAL( generic_out[channel][i], in[channel][i] );
+            BOOST_REQUIRE_EQUAL( simd_out[channel][i], in[channel][i] );
+        }
+    }
+
+    /* fused gain */
+    const float_type gain = 0.5;
+    interleave_vec_simd(simd.c_array(), in, channels, gain, size);
+    deinterleave_vec_simd(simd_out, simd.c_array(), channels, gain, size);
+    interleave_vec(generic.c_array(), in, channels, gain, size);
+
+    for (unsigned int channel = 0; channel != channels; ++channel) {
+        for (int i = 0; i != size; ++i) {
+            BOOST_REQUIRE_EQUAL( simd[i * channels + channel], in[channel][i] * gain );
+            BOOST_REQUIRE_EQUAL( generic[i * channels + channel], in[channel][i] * gain );
+            BOOST_REQUIRE_EQUAL( simd_out[channel][i], in[channel][i] * gain * gain );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( interleave_tests )
+{
+    for (unsigned int channels = 1; channels <= max_channels; ++channels) {
+        test_interleave<float>(channels);
+        test_interleave<double>(channels);
+    }
+}
+
+template <typename float_type>
+void test_shuffles(void)
+{
+    typedef vec<float_type> vec_type;
+    const int vec_size = vec_type::size;
+
+    aligned_array<float_type, 4 * vec_size> data;
+    for (int i = 0; i != 2 * vec_size; ++i)
+        data[i] = float_type(i);
+
+    vec_type lhs, rhs, low, high;
+    lhs.load_aligned(data.c_array());
+    rhs.load_aligned(data.c_array() + vec_size);
+    interleave(lhs, rhs, low, high);
+    low.store_aligned(data.c_array());
+    high.store_aligned(data.c_array() + vec_size);
+
+    for (int i = 0; i != vec_size; ++i) {
+        BOOST_REQUIRE_EQUAL( data[2 * i], float_type(i) );
+        BOOST_REQUIRE_EQUAL( data[2 * i + 1], float_type(vec_size + i) );
+    }
+
+    deinterleave(low, high, lhs, rhs);
+    lhs.store_aligned(data.c_array());
+    rhs.store_aligned(data.c_array() + vec_size);
+    for (int i = 0; i != 2 * vec_size; ++i)
+        BOOST_REQUIRE_EQUAL( data[i], float_type(i) );
+
+    for (int count = 0; count != vec_size; ++count) {
+        shift_lanes_up(lhs, count).store_aligned(data.c_array());
+        shift_lanes_down(lhs, count).store_aligned(data.c_array() + vec_size);
+        for (int i = 0; i != vec_size; ++i) {
+            BOOST_REQUIRE_EQUAL( data[i], float_type(std::max(i - count, 0)) );
+            BOOST_REQUIRE_EQUAL( data[vec_size + i], float_type(std::min(i + count, vec_size - 1)) );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( shuffle_tests )
+{
+    test_shuffles<float>();
+    test_shuffles<double>();
+}
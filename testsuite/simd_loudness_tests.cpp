@@ -0,0 +1,149 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "../simd_loudness.hpp"
+#include "test_helper.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const int size = 64;
+static const int channels = 5;
+static const double samplerate = 48000;
+static const double two_pi = 6.283185307179586476925286766559;
+
+/* coefficients of the k-weighting filter at 48 kHz, as given by BS.1770 */
+BOOST_AUTO_TEST_CASE( k_weighting_tests )
+{
+    detail::biquad_coefficients shelf = detail::k_weighting_shelf(48000);
+    BOOST_REQUIRE_CLOSE( shelf.b0, 1.53512485958697, 1e-6 );
+    BOOST_REQUIRE_CLOSE( shelf.b1, -2.69169618940638, 1e-6 );
+    BOOST_REQUIRE_CLOSE( shelf.b2, 1.19839281085285, 1e-6 );
+    BOOST_REQUIRE_CLOSE( shelf.a1, -1.69065929318241, 1e-6 );
+    BOOST_REQUIRE_CLOSE( shelf.a2, 0.73248077421585, 1e-6 );
+
+    detail::biquad_coefficients highpass = detail::k_weighting_highpass(48000);
+    BOOST_REQUIRE_CLOSE( highpass.a1, -1.99004745483398, 1e-6 );
+    BOOST_REQUIRE_CLOSE( highpass.a2, 0.99007225036621, 1e-6 );
+}
+
+/* 1 kHz sine with the given peak level (dBFS) on the first two channels for the given duration */
+template <typename float_type>
+void run_sine(loudness_meter<float_type> & meter, double level, double seconds, int & index, bool simd)
+{
+    aligned_array<float_type, size * channels> input;
+    const float_type * in[channels];
+    for (int channel = 0; channel != channels; ++channel)
+        in[channel] = input.c_array() + channel * size;
+    input.assign(0);
+
+    const double amplitude = pow(10.0, level / 20);
+    const int blocks = int(seconds * samplerate) / size;
+    for (int block = 0; block != blocks; ++block) {
+        for (int i = 0; i != size; ++i, ++index) {
+            input[i] = float_type(amplitude * sin(two_pi * 1000 * index / samplerate));
+            input[size + i] = input[i];
+        }
+
+        if (simd)
+            meter.process_simd(in, size);
+        else
+            meter.process(in, size);
+    }
+}
+
+/* EBU Tech 3341, test case 1: stereo sine at -23 dBFS */
+template <typename float_type>
+void test_steady(bool simd)
+{
+    loudness_meter<float_type> meter(channels, samplerate);
+    BOOST_REQUIRE( meter.integrated() < -1e10 );
+
+    int index = 0;
+    run_sine(meter, -23, 4, index, simd);
+
+    BOOST_REQUIRE_SMALL( meter.momentary() + 23, 0.1 );
+    BOOST_REQUIRE_SMALL( meter.short_term() + 23, 0.1 );
+    BOOST_REQUIRE_SMALL( meter.integrated() + 23, 0.1 );
+
+    /* channel weights scale the energy */
+    loudness_meter<float_type> weighted(channels, samplerate);
+    weighted.set_channel_weight(1, 0);
+    index = 0;
+    run_sine(weighted, -23, 1, index, simd);
+    BOOST_REQUIRE_SMALL( weighted.momentary() + 26.01, 0.1 );
+}
+
+BOOST_AUTO_TEST_CASE( steady_tests )
+{
+    test_steady<float>(false);
+    test_steady<float>(true);
+    test_steady<double>(false);
+    test_steady<double>(true);
+}
+
+/* EBU Tech 3341, test cases 3 and 4: quiet parts are removed by the relative gate, silence by the
+ * absolute gate */
+template <typename float_type>
+void test_gating(bool simd)
+{
+    loudness_meter<float_type> meter(channels, samplerate);
+    int index = 0;
+    run_sine(meter, -36, 4, index, simd);
+    run_sine(meter, -23, 20, index, simd);
+    run_sine(meter, -36, 4, index, simd);
+    run_sine(meter, -200, 4, index, simd);
+    BOOST_REQUIRE_SMALL( meter.integrated() + 23, 0.1 );
+    BOOST_REQUIRE( meter.momentary() < -70 );
+
+    meter.reset();
+    BOOST_REQUIRE( meter.integrated() < -1e10 );
+    index = 0;
+    run_sine(meter, -72, 1, index, simd);
+    BOOST_REQUIRE( meter.integrated() < -1e10 );
+}
+
+BOOST_AUTO_TEST_CASE( gating_tests )
+{
+    test_gating<float>(false);
+    test_gating<float>(true);
+    test_gating<double>(false);
+    test_gating<double>(true);
+}
+
+/* both versions compute the same loudness for different signals in all channels */
+template <typename float_type>
+void test_simd(void)
+{
+    loudness_meter<float_type> generic(channels, samplerate), simd(channels, samplerate);
+    aligned_array<float_type, size * channels> input;
+    const float_type * in[channels];
+    for (int channel = 0; channel != channels; ++channel)
+        in[channel] = input.c_array() + channel * size;
+
+    for (int block = 0; block != 48000 / size; ++block) {
+        for (int channel = 0; channel != channels; ++channel)
+            for (int i = 0; i != size; ++i)
+                input[channel * size + i] = float_type(0.1 * (channel + 1) *
+                                                       sin(two_pi * 100 * (channel + 1) * (block * size + i) / samplerate));
+        generic.process(in, size);
+        simd.process_simd(in, size);
+
+        if (block * size >= 4800)
+            BOOST_REQUIRE_SMALL( generic.momentary() - simd.momentary(), 1e-3 );
+    }
+    BOOST_REQUIRE_SMALL( generic.short_term() - simd.short_term(), 1e-3 );
+    BOOST_REQUIRE_SMALL( generic.integrated() - simd.integrated(), 1e-3 );
+}
+
+BOOST_AUTO_TEST_CASE( simd_tests )
+{
+    test_simd<float>();
+    test_simd<double>();
+}
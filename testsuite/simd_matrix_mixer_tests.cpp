@@ -0,0 +1,110 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+
+#include "../simd_matrix_mixer.hpp"
+#include "test_helper.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const int size = 72;
+static const unsigned int inputs = 13;
+static const unsigned int outputs = 7;
+
+template <typename float_type>
+void test_matrix_mixer(bool simd)
+{
+    matrix_mixer<float_type> mixer(inputs, outputs);
+
+    aligned_array<float_type, size * inputs> in;
+    aligned_array<float_type, size * outputs> out;
+    const float_type * ins[inputs];
+    float_type * outs[outputs];
+    for (unsigned int input = 0; input != inputs; ++input)
+        ins[input] = in.begin() + input * size;
+    for (unsigned int output = 0; output != outputs; ++output)
+        outs[output] = out.begin() + output * size;
+
+    randomize_buffer<float_type>(in.c_array(), size * inputs);
+
+    /* sparse matrix, output 5 is silent */
+    float_type gains[outputs][inputs];
+    for (unsigned int output = 0; output != outputs; ++output) {
+        for (unsigned int input = 0; input != inputs; ++input) {
+            const bool connected = output != 5 && (output + 2 * input) % 3 == 0;
+            gains[output][input] = connected ? float_type(0.1 * (input + 1) - 0.05 * output) : float_type(0);
+            mixer.set_gain(output, input, gains[output][input]);
+        }
+    }
+    mixer.reset();
+
+    for (int block = 0; block != 3; ++block) {
+        float_type previous[outputs][inputs];
+        std::copy(&gains[0][0], &gains[0][0] + outputs * inputs, &previous[0][0]);
+
+        if (block == 2) {
+            /* ramp some crosspoints */
+            gains[1][4] = float_type(-0.5);
+            gains[3][0] = 0;
+            gains[5][12] = float_type(0.25);
+            mixer.set_gain(1, 4, gains[1][4]);
+            mixer.set_gain(3, 0, gains[3][0]);
+            mixer.set_gain(5, 12, gains[5][12]);
+        }
+
+        if (simd)
+            mixer.process_simd(outs, ins, size);
+        else
+            mixer.process(outs, ins, size);
+
+        for (unsigned int output = 0; output != outputs; ++output) {
+            for (int i = 0; i != size; ++i) {
+                double expected = 0;
+                for (unsigned int input = 0; input != inputs; ++input) {
+                    const double g = previous[output][input] + (gains[output][input] - previous[output][input]) * i / size;
+                    expected += g * ins[input][i];
+                }
+                BOOST_REQUIRE_SMALL( outs[output][i] - float_type(expected), float_type(1e-5) );
+            }
+        }
+
+        BOOST_REQUIRE_EQUAL( mixer.gain(1, 4), gains[1][4] );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( matrix_mixer_tests )
+{
+    test_matrix_mixer<float>(false);
+    test_matrix_mixer<float>(true);
+    test_matrix_mixer<double>(false);
+    test_matrix_mixer<double>(true);
+}
+
+template <typename float_type>
+void test_silent(void)
+{
+    matrix_mixer<float_type> mixer(2, 4);
+
+    aligned_array<float_type, size * 2> in;
+    aligned_array<float_type, size * 4> out;
+    const float_type * ins[2] = {in.begin(), in.begin() + size};
+    float_type * outs[4] = {out.begin(), out.begin() + size, out.begin() + 2 * size, out.begin() + 3 * size};
+
+    randomize_buffer<float_type>(in.c_array(), size * 2);
+    out.assign(float_type(1));
+
+    mixer.process_simd(outs, ins, size);
+    for (int i = 0; i != size * 4; ++i)
+        BOOST_REQUIRE_EQUAL( out[i], float_type(0) );
+}
+
+BOOST_AUTO_TEST_CASE( silent_tests )
+{
+    test_silent<float>();
+    test_silent<double>();
+}
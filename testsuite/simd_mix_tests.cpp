@@ -132,3 +132,62 @@ BOOST_AUTO_TEST_CASE( sum_tests )
     test_sum4<float>();
     test_sum4<double>();
 }
+
+static double crossfade_reference(double sig0, double sig1, double position, crossfade_curve curve)
+{
+    const double x = std::max(0.0, std::min(position, 1.0));
+    switch (curve) {
+    case equal_power_crossfade:
+        return sig0 * cos(x * M_PI * 0.5) + sig1 * sin(x * M_PI * 0.5);
+    case sqrt_crossfade:
+        return sig0 * sqrt(1 - x) + sig1 * sqrt(x);
+    case s_curve_crossfade:
+        return sig0 + (sig1 - sig0) * x * x * (3 - 2 * x);
+    default:
+        return sig0 + (sig1 - sig0) * x;
+    }
+}
+
+template <typename float_type>
+void test_crossfade(crossfade_curve curve)
+{
+    aligned_array<float_type, size>  sseval, generic, args0, args1, positions;
+    randomize_buffer<float_type>(args0.c_array(), size);
+    randomize_buffer<float_type>(args1.c_array(), size);
+
+    /* position ramp, overshooting both ends */
+    const float_type start = -0.1;
+    const float_type slope = 1.2 / size;
+    crossfade_vec(generic.c_array(), args0.c_array(), args1.c_array(), slope_argument(start, slope), curve, size);
+    crossfade_vec_simd(sseval.c_array(), args0.c_array(), args1.c_array(), slope_argument(start, slope), curve, size);
+
+    for (int i = 0; i != size; ++i) {
+        const double expected = crossfade_reference(args0[i], args1[i], start + i * slope, curve);
+        BOOST_REQUIRE_SMALL( generic[i] - float_type(expected), float_type(1e-4) );
+        BOOST_REQUIRE_SMALL( sseval[i] - float_type(expected), float_type(1e-4) );
+    }
+
+    /* in-place wet/dry with a position buffer */
+    for (int i = 0; i != size; ++i)
+        positions[i] = float_type(i % 11) / 10;
+
+    generic = args0;
+    sseval = args0;
+    wet_dry_vec(generic.c_array(), args1.c_array(), positions.c_array(), curve, size);
+    wet_dry_vec_simd(sseval.c_array(), args1.c_array(), positions.c_array(), curve, size);
+
+    for (int i = 0; i != size; ++i) {
+        const double expected = crossfade_reference(args0[i], args1[i], positions[i], curve);
+        BOOST_REQUIRE_SMALL( generic[i] - float_type(expected), float_type(1e-5) );
+        BOOST_REQUIRE_SMALL( sseval[i] - float_type(expected), float_type(1e-4) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( crossfade_tests )
+{
+    const crossfade_curve curves[] = {linear_crossfade, equal_power_crossfade, sqrt_crossfade, s_curve_crossfade};
+    for (int curve = 0; curve != 4; ++curve) {
+        test_crossfade<float>(curves[curve]);
+        test_crossfade<double>(curves[curve]);
+    }
+}
@@ -0,0 +1,134 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+
+#include "../simd_noise.hpp"
+#include "test_helper.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const int size = 4096;
+static const int blocks = 16;
+
+template <typename float_type>
+void statistics(const float_type * data, int n, double & mean, double & variance, double & difference_variance)
+{
+    double sum = 0, squared_sum = 0, difference_sum = 0;
+    for (int i = 0; i != n; ++i) {
+        sum += data[i];
+        squared_sum += data[i] * data[i];
+        if (i)
+            difference_sum += (data[i] - data[i-1]) * (data[i] - data[i-1]);
+    }
+    mean = sum / n;
+    variance = squared_sum / n - mean * mean;
+    difference_variance = difference_sum / (n - 1);
+}
+
+template <typename float_type>
+void test_white(void)
+{
+    aligned_array<float_type, size> generic, simd;
+    noise_generator<float_type> generic_noise(42), simd_noise(42);
+
+    for (int block = 0; block != blocks; ++block) {
+        generic_noise.white(generic.c_array(), size);
+        simd_noise.white_simd(simd.c_array(), size);
+
+        for (int i = 0; i != size; ++i) {
+            BOOST_REQUIRE_EQUAL( generic[i], simd[i] );
+            BOOST_REQUIRE( generic[i] >= -1 && generic[i] < 1 );
+        }
+    }
+
+    double mean, variance, difference_variance;
+    statistics(simd.c_array(), size, mean, variance, difference_variance);
+    BOOST_CHECK_SMALL( mean, 0.05 );
+    BOOST_CHECK_CLOSE( variance, 1.0 / 3.0, 5 );
+    BOOST_CHECK_CLOSE( difference_variance, 2.0 / 3.0, 5 );
+
+    /* different seeds generate different sequences */
+    noise_generator<float_type> other(43);
+    other.white_simd(generic.c_array(), size);
+    simd_noise.seed(42);
+    simd_noise.white_simd(simd.c_array(), size);
+    int equal = 0;
+    for (int i = 0; i != size; ++i)
+        equal += generic[i] == simd[i];
+    BOOST_CHECK_LT( equal, 4 );
+}
+
+BOOST_AUTO_TEST_CASE( white_noise_tests )
+{
+    test_white<float>();
+    test_white<double>();
+}
+
+template <typename float_type>
+void test_colored(void)
+{
+    aligned_array<float_type, size> generic, simd;
+    noise_generator<float_type> generic_noise(7), simd_noise(7);
+
+    for (int block = 0; block != blocks; ++block) {
+        generic_noise.pink(generic.c_array(), size);
+        simd_noise.pink_simd(simd.c_array(), size);
+        for (int i = 0; i != size; ++i)
+            BOOST_REQUIRE_EQUAL( generic[i], simd[i] );
+    }
+
+    /* low-frequency content: neighboring samples are correlated */
+    double mean, variance, difference_variance;
+    statistics(simd.c_array(), size, mean, variance, difference_variance);
+    BOOST_CHECK_LT( difference_variance, variance );
+    BOOST_CHECK_GT( difference_variance, 0.01 * variance );
+
+    for (int block = 0; block != blocks; ++block) {
+        generic_noise.brown(generic.c_array(), size);
+        simd_noise.brown_simd(simd.c_array(), size);
+        for (int i = 0; i != size; ++i)
+            BOOST_REQUIRE_EQUAL( generic[i], simd[i] );
+    }
+
+    statistics(simd.c_array(), size, mean, variance, difference_variance);
+    BOOST_CHECK_LT( difference_variance, 0.1 * variance );
+}
+
+BOOST_AUTO_TEST_CASE( colored_noise_tests )
+{
+    test_colored<float>();
+    test_colored<double>();
+}
+
+template <typename float_type>
+void test_dust(void)
+{
+    aligned_array<float_type, size> generic, simd;
+    noise_generator<float_type> generic_noise(3), simd_noise(3);
+    const float_type density = 0.01;
+
+    int impulses = 0;
+    for (int block = 0; block != blocks; ++block) {
+        generic_noise.dust(generic.c_array(), density, size);
+        simd_noise.dust_simd(simd.c_array(), density, size);
+
+        for (int i = 0; i != size; ++i) {
+            BOOST_REQUIRE_CLOSE( generic[i], simd[i], 0.0001 );
+            BOOST_REQUIRE( simd[i] >= 0 && simd[i] < 1 );
+            impulses += simd[i] != 0;
+        }
+    }
+
+    BOOST_CHECK_CLOSE( double(impulses), double(density) * size * blocks, 10 );
+}
+
+BOOST_AUTO_TEST_CASE( dust_tests )
+{
+    test_dust<float>();
+    test_dust<double>();
+}
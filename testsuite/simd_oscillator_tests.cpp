@@ -0,0 +1,201 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+
+#include "../simd_oscillators.hpp"
+#include "test_helper.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const int size = 512;
+
+/* the _simd versions compute the phases of scalar and slope increments in closed form, so they are
+ * compared against a double precision reference. close to a discontinuity the polyblep amplifies the
+ * rounding of the phase by up to 2 / increment */
+template <typename float_type>
+void test_saw(void)
+{
+    aligned_array<float_type, size> generic, simd;
+    aligned_array<double, size> reference;
+    const float_type increment = 0.0123;
+    float_type generic_phase = 0.25, simd_phase = 0.25;
+    double reference_phase = 0.25;
+
+    saw_vec(generic.c_array(), &generic_phase, increment, size);
+    saw_vec_simd(simd.c_array(), &simd_phase, increment, size);
+    saw_vec(reference.c_array(), &reference_phase, double(increment), size);
+
+    const double exact_phase = fmod(0.25 + size * double(increment), 1.0);
+    BOOST_CHECK_SMALL( generic_phase - float_type(exact_phase), float_type(1e-4) );
+    BOOST_CHECK_SMALL( simd_phase - float_type(exact_phase), float_type(1e-5) );
+
+    float_type phase = 0.25;
+    for (int i = 0; i != size; ++i) {
+        const bool corrected = phase < 2 * increment || phase > 1 - 2 * increment;
+        BOOST_CHECK_SMALL( simd[i] - float_type(reference[i]), float_type(corrected ? 1e-3 : 1e-5) );
+
+        /* away from the discontinuity, the naive waveform is not modified */
+        if (phase > increment && phase < 1 - increment)
+            BOOST_CHECK_SMALL( generic[i] - (2 * phase - 1), float_type(1e-5) );
+
+        /* the corrections do not overshoot */
+        BOOST_CHECK_LE( abs(generic[i]), float_type(1.0001) );
+        BOOST_CHECK_LE( abs(simd[i]), float_type(1.0001) );
+
+        phase += increment;
+        if (phase >= 1)
+            phase -= 1;
+    }
+
+    /* falling increment. the rounding of long ramps accumulates quadratically in the phases, in float
+     * the scalar version drifts by about 7e-4 */
+    const float_type start = 0.3, slope = -0.0005;
+    simd_phase = 0.75;
+    reference_phase = 0.75;
+    saw_vec_simd(simd.c_array(), &simd_phase, slope_argument(start, slope), size);
+    saw_vec(reference.c_array(), &reference_phase, slope_argument(double(start), double(slope)), size);
+
+    BOOST_CHECK_SMALL( simd_phase - float_type(reference_phase), float_type(5e-4) );
+
+    double t = 0.75;
+    for (int i = 0; i != size; ++i) {
+        const double dt = double(start) + i * double(slope);
+        const bool corrected = t < 2 * dt || t > 1 - 2 * dt;
+        BOOST_CHECK_SMALL( simd[i] - float_type(reference[i]), float_type(corrected ? 1e-2 : 1e-3) );
+
+        t += dt;
+        if (t >= 1)
+            t -= 1;
+    }
+}
+
+BOOST_AUTO_TEST_CASE( saw_tests )
+{
+    test_saw<float>();
+    test_saw<double>();
+}
+
+template <typename float_type>
+void test_pulse(void)
+{
+    aligned_array<float_type, size> generic, simd, width;
+    aligned_array<double, size> reference, reference_width;
+    for (int i = 0; i != size; ++i) {
+        width[i] = float_type(0.5 + 0.4 * sin(i * 0.01));
+        reference_width[i] = width[i];
+    }
+
+    const float_type increment = 0.01, slope = 0.00005;
+    float_type generic_phase = 0, simd_phase = 0;
+    double reference_phase = 0;
+    pulse_vec(generic.c_array(), &generic_phase, slope_argument(increment, slope), width.c_array(), size);
+    pulse_vec_simd(simd.c_array(), &simd_phase, slope_argument(increment, slope), width.c_array(), size);
+    pulse_vec(reference.c_array(), &reference_phase, slope_argument(double(increment), double(slope)),
+              reference_width.c_array(), size);
+
+    BOOST_CHECK_SMALL( generic_phase - float_type(reference_phase), float_type(1e-4) );
+    BOOST_CHECK_SMALL( simd_phase - float_type(reference_phase), float_type(5e-5) );
+
+    double t = 0;
+    for (int i = 0; i != size; ++i) {
+        const double dt = double(increment) + i * double(slope);
+        const bool corrected = t < 2 * dt || t > 1 - 2 * dt || abs(t - reference_width[i]) < 2 * dt;
+        BOOST_CHECK_SMALL( simd[i] - float_type(reference[i]), float_type(corrected ? 1e-3 : 1e-4) );
+        BOOST_CHECK_LE( abs(generic[i]), float_type(1.0001) );
+
+        t += dt;
+        if (t >= 1)
+            t -= 1;
+    }
+
+    /* fixed width: the mean is 2 * width - 1 */
+    float_type phase = 0;
+    pulse_vec_simd(simd.c_array(), &phase, float_type(1) / float_type(64), float_type(0.25), size);
+    float_type sum = 0;
+    for (int i = 0; i != size; ++i)
+        sum += simd[i];
+    BOOST_CHECK_SMALL( sum / size + float_type(0.5), float_type(1e-4) );
+}
+
+BOOST_AUTO_TEST_CASE( pulse_tests )
+{
+    test_pulse<float>();
+    test_pulse<double>();
+}
+
+template <typename float_type>
+void test_triangle(void)
+{
+    aligned_array<float_type, size> generic, simd, increment;
+    randomize_buffer<float_type>(increment.c_array(), size, 0.05, 0.01);
+
+    float_type generic_phase = 0.9, simd_phase = 0.9;
+    triangle_vec(generic.c_array(), &generic_phase, increment.c_array(), size);
+    triangle_vec_simd(simd.c_array(), &simd_phase, increment.c_array(), size);
+
+    BOOST_CHECK_CLOSE( generic_phase, simd_phase, 0.0001 );
+
+    float_type phase = 0.9;
+    for (int i = 0; i != size; ++i) {
+        BOOST_CHECK_SMALL( simd[i] - generic[i], float_type(1e-5) );
+        BOOST_CHECK_LE( abs(generic[i]), float_type(1) );
+
+        /* corners are rounded towards the center */
+        const float_type naive = 1 - 4 * abs(phase - float_type(0.5));
+        BOOST_CHECK_LE( abs(generic[i]), abs(naive) + float_type(1e-5) );
+
+        phase += increment[i];
+        if (phase >= 1)
+            phase -= 1;
+    }
+}
+
+BOOST_AUTO_TEST_CASE( triangle_tests )
+{
+    test_triangle<float>();
+    test_triangle<double>();
+}
+
+template <typename float_type>
+void test_saw_sync(void)
+{
+    aligned_array<float_type, size> generic, simd, reference;
+
+    /* synced to itself, the output is a plain saw */
+    {
+        hard_sync_state<float_type> state;
+        float_type phase = 0;
+        saw_sync_vec_simd(simd.c_array(), state, float_type(0.01), float_type(0.01), size);
+        saw_vec_simd(reference.c_array(), &phase, float_type(0.01), size);
+
+        for (int i = 0; i != size; ++i)
+            BOOST_CHECK_SMALL( simd[i] - reference[i], float_type(1e-3) );
+    }
+
+    /* the synced output has the period of the master */
+    {
+        hard_sync_state<float_type> generic_state, simd_state;
+        const float_type master = float_type(1) / float_type(64);
+        saw_sync_vec(generic.c_array(), generic_state, float_type(0.037), master, size);
+        saw_sync_vec_simd(simd.c_array(), simd_state, float_type(0.037), master, size);
+
+        BOOST_CHECK_CLOSE( generic_state.phase, simd_state.phase, 0.0001 );
+        for (int i = 0; i != size; ++i) {
+            BOOST_CHECK_SMALL( simd[i] - generic[i], float_type(1e-5) );
+            BOOST_CHECK_LE( abs(generic[i]), float_type(1.0001) );
+            if (i >= 128)
+                BOOST_CHECK_SMALL( generic[i] - generic[i - 64], float_type(1e-4) );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( saw_sync_tests )
+{
+    test_saw_sync<float>();
+    test_saw_sync<double>();
+}
@@ -0,0 +1,154 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "../simd_oversampler.hpp"
+#include "../simd_binary_arithmetic.hpp"
+#include "../simd_math.hpp"
+#include "../softclip.hpp"
+#include "test_helper.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const int size = 64;
+static const int blocks = 64;
+static const double two_pi = 6.283185307179586476925286766559;
+
+/* the upsampled signal is the band-limited interpolation of the input */
+template <typename float_type>
+void test_upsample(unsigned int factor)
+{
+    const double frequency = 0.05;
+    oversampler<float_type> generic(factor, size), simd(factor, size);
+    aligned_array<float_type, size> in;
+
+    int index = 0;
+    for (int block = 0; block != blocks; ++block) {
+        for (int i = 0; i != size; ++i)
+            in[i] = float_type(sin(two_pi * frequency * (block * size + i)));
+
+        const float_type * generic_out = generic.upsample(in.c_array(), size);
+        const float_type * simd_out = simd.upsample_simd(in.c_array(), size);
+
+        for (unsigned int i = 0; i != size * factor; ++i, ++index) {
+            BOOST_REQUIRE_SMALL( generic_out[i] - simd_out[i], float_type(1e-5) );
+
+            /* half of the latency is caused by the upsampler */
+            const double time = double(index) / factor - 0.5 * generic.latency();
+            if (time > generic.latency())
+                BOOST_REQUIRE_SMALL( double(generic_out[i]) - sin(two_pi * frequency * time), 1e-3 );
+        }
+
+        generic.downsample(in.c_array(), size);
+        simd.downsample_simd(in.c_array(), size);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( upsample_tests )
+{
+    for (unsigned int factor = 1; factor <= 8; factor *= 2) {
+        test_upsample<float>(factor);
+        test_upsample<double>(factor);
+    }
+}
+
+/* without processing, the output is the delayed input */
+template <typename float_type>
+void test_roundtrip(unsigned int factor)
+{
+    const double frequency = 0.03;
+    oversampler<float_type> generic(factor, size), simd(factor, size);
+    aligned_array<float_type, size> in, generic_out, simd_out;
+
+    for (int block = 0; block != blocks; ++block) {
+        for (int i = 0; i != size; ++i)
+            in[i] = float_type(0.25 * sin(two_pi * frequency * (block * size + i)));
+
+        generic.process(generic_out.c_array(), in.c_array(), size, detail::softclip());
+        simd.process_simd(simd_out.c_array(), in.c_array(), size, detail::softclip());
+
+        for (int i = 0; i != size; ++i) {
+            BOOST_REQUIRE_SMALL( generic_out[i] - simd_out[i], float_type(1e-5) );
+
+            /* softclip is linear for small signals */
+            const int delayed = block * size + i - int(simd.latency());
+            if (delayed > int(simd.latency()))
+                BOOST_REQUIRE_SMALL( double(simd_out[i]) - 0.25 * sin(two_pi * frequency * delayed), 1e-3 );
+        }
+    }
+
+    /* binary functor with scalar argument */
+    oversampler<float_type> scaled(factor, size);
+    for (int block = 0; block != blocks; ++block) {
+        for (int i = 0; i != size; ++i)
+            in[i] = float_type(sin(two_pi * frequency * (block * size + i)));
+        scaled.process_simd(simd_out.c_array(), in.c_array(), float_type(2), size, detail::multiplies());
+
+        for (int i = 0; i != size; ++i) {
+            const int delayed = block * size + i - int(scaled.latency());
+            if (delayed > int(scaled.latency()))
+                BOOST_REQUIRE_SMALL( double(simd_out[i]) - 2 * sin(two_pi * frequency * delayed), 2e-3 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( roundtrip_tests )
+{
+    for (unsigned int factor = 1; factor <= 8; factor *= 2) {
+        test_roundtrip<float>(factor);
+        test_roundtrip<double>(factor);
+    }
+}
+
+/* magnitude of the dft bin of a signal of length n */
+template <typename float_type>
+double bin_magnitude(const float_type * data, int n, int bin)
+{
+    double re = 0, im = 0;
+    for (int i = 0; i != n; ++i) {
+        re += data[i] * cos(two_pi * bin * i / n);
+        im += data[i] * sin(two_pi * bin * i / n);
+    }
+    return sqrt(re * re + im * im) * 2 / n;
+}
+
+/* the 5th harmonic of a saturated sine at bin 640 folds back to bin 896 without oversampling */
+template <typename float_type>
+double aliasing(unsigned int factor)
+{
+    const int length = 4096;
+    const int warmup = 1024;
+    oversampler<float_type> os(factor, size);
+    std::vector<float_type> out(length + warmup);
+    aligned_array<float_type, size> in;
+
+    for (int block = 0; block != (length + warmup) / size; ++block) {
+        for (int i = 0; i != size; ++i)
+            in[i] = float_type(2 * sin(two_pi * 640 * (block * size + i) / length));
+        os.process_simd(&out[block * size], in.c_array(), size, detail::tanh_());
+    }
+
+    return bin_magnitude(&out[warmup], length, 896);
+}
+
+template <typename float_type>
+void test_aliasing(void)
+{
+    const double reference = aliasing<float_type>(1);
+    BOOST_CHECK_GT( reference, 1e-3 );
+    BOOST_CHECK_LT( aliasing<float_type>(2), 0.01 * reference );
+    BOOST_CHECK_LT( aliasing<float_type>(4), 0.01 * reference );
+    BOOST_CHECK_LT( aliasing<float_type>(8), 0.01 * reference );
+}
+
+BOOST_AUTO_TEST_CASE( aliasing_tests )
+{
+    test_aliasing<float>();
+    test_aliasing<double>();
+}
@@ -72,3 +72,118 @@ BOOST_AUTO_TEST_CASE( pan2_ramp_tests )
     test_pan2_ramp<float>();
     test_pan2_ramp<double>();
 }
+
+template <typename float_type>
+void test_pan2_equal_power(void)
+{
+    aligned_array<float_type, size> in, position, generic0, generic1, simd0, simd1;
+    randomize_buffer<float_type>(in.c_array(), size);
+    for (int i = 0; i != size; ++i)
+        position[i] = float_type(-1.2 + 2.4 * i / size);
+
+    pan2_equal_power_vec(generic0.c_array(), generic1.c_array(), in.c_array(), position.c_array(), size);
+    pan2_equal_power_vec_simd(simd0.c_array(), simd1.c_array(), in.c_array(), position.c_array(), size);
+
+    for (int i = 0; i != size; ++i) {
+        BOOST_REQUIRE_SMALL( generic0[i] - simd0[i], float_type(1e-5) );
+        BOOST_REQUIRE_SMALL( generic1[i] - simd1[i], float_type(1e-5) );
+
+        /* constant power */
+        BOOST_REQUIRE_SMALL( simd0[i] * simd0[i] + simd1[i] * simd1[i] - in[i] * in[i], float_type(1e-5) );
+    }
+
+    /* hard left/right and center, using a slope from -1 to 1 */
+    const float_type one = 1;
+    pan2_equal_power_vec_simd(simd0.c_array(), simd1.c_array(), one,
+                              slope_argument(float_type(-1), float_type(2) / float_type(size)), size);
+    BOOST_REQUIRE_SMALL( simd0[0] - float_type(1), float_type(1e-5) );
+    BOOST_REQUIRE_SMALL( simd1[0], float_type(1e-5) );
+    BOOST_REQUIRE_CLOSE( simd0[size / 2], float_type(sqrt(0.5)), 1e-3 );
+    BOOST_REQUIRE_CLOSE( simd1[size / 2], float_type(sqrt(0.5)), 1e-3 );
+}
+
+BOOST_AUTO_TEST_CASE( pan2_equal_power_tests )
+{
+    test_pan2_equal_power<float>();
+    test_pan2_equal_power<double>();
+}
+
+template <typename float_type>
+void test_balance2(void)
+{
+    aligned_array<float_type, size> in0, in1, position, generic0, generic1, simd0, simd1;
+    randomize_buffer<float_type>(in0.c_array(), size);
+    randomize_buffer<float_type>(in1.c_array(), size);
+    for (int i = 0; i != size; ++i)
+        position[i] = float_type(-1 + 2.0 * i / size);
+
+    balance2_vec(generic0.c_array(), generic1.c_array(), in0.c_array(), in1.c_array(), position.c_array(),
+                 float_type(0.5), size);
+    balance2_vec_simd(simd0.c_array(), simd1.c_array(), in0.c_array(), in1.c_array(), position.c_array(),
+                      float_type(0.5), size);
+
+    for (int i = 0; i != size; ++i) {
+        BOOST_REQUIRE_SMALL( generic0[i] - simd0[i], float_type(1e-5) );
+        BOOST_REQUIRE_SMALL( generic1[i] - simd1[i], float_type(1e-5) );
+    }
+
+    /* left channel untouched up to the center, right channel faded out */
+    BOOST_REQUIRE_CLOSE( simd0[0], in0[0] * float_type(0.5), 1e-3 );
+    BOOST_REQUIRE_SMALL( simd1[0], float_type(1e-5) );
+    BOOST_REQUIRE_CLOSE( simd0[size / 2], in0[size / 2] * float_type(0.5), 1e-3 );
+    BOOST_REQUIRE_CLOSE( simd1[size / 2], in1[size / 2] * float_type(0.5), 1e-3 );
+}
+
+BOOST_AUTO_TEST_CASE( balance2_tests )
+{
+    test_balance2<float>();
+    test_balance2<double>();
+}
+
+template <typename float_type>
+void test_panaz(unsigned int channels)
+{
+    const int max_channels = 8;
+    aligned_array<float_type, size> in, position;
+    aligned_array<float_type, size * max_channels> generic, simd;
+    float_type * generic_out[max_channels], * simd_out[max_channels];
+    for (int channel = 0; channel != max_channels; ++channel) {
+        generic_out[channel] = generic.c_array() + channel * size;
+        simd_out[channel] = simd.c_array() + channel * size;
+    }
+
+    in.assign(1);
+    for (int i = 0; i != size; ++i)
+        position[i] = float_type(4.0 * i / size - 1);
+
+    panaz_vec(generic_out, channels, in.c_array(), position.c_array(), float_type(2), size);
+    panaz_vec_simd(simd_out, channels, in.c_array(), position.c_array(), float_type(2), size);
+
+    for (int i = 0; i != size; ++i) {
+        float_type power = 0;
+        for (unsigned int channel = 0; channel != channels; ++channel) {
+            BOOST_REQUIRE_SMALL( generic_out[channel][i] - simd_out[channel][i], float_type(1e-5) );
+            power += simd_out[channel][i] * simd_out[channel][i];
+        }
+        BOOST_REQUIRE_CLOSE( power, float_type(1), 1e-3 );
+    }
+
+    /* on a speaker, between two speakers */
+    panaz_vec_simd(simd_out, channels, in.c_array(), float_type(2) / float_type(channels), float_type(2), size);
+    for (unsigned int channel = 0; channel != channels; ++channel)
+        BOOST_REQUIRE_SMALL( simd_out[channel][0] - float_type(channel == 1 ? 1 : 0), float_type(1e-5) );
+
+    panaz_vec(generic_out, channels, in.c_array(), float_type(3) / float_type(channels), float_type(2), size);
+    for (unsigned int channel = 0; channel != channels; ++channel) {
+        const float_type expected = (channel == 1 || channel == 2 % channels) ? float_type(sqrt(0.5)) : 0;
+        BOOST_REQUIRE_SMALL( generic_out[channel][size - 1] - expected, float_type(1e-5) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( panaz_tests )
+{
+    for (unsigned int channels = 3; channels <= 8; ++channels) {
+        test_panaz<float>(channels);
+        test_panaz<double>(channels);
+    }
+}
@@ -0,0 +1,167 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+
+#include "../simd_pcm.hpp"
+#include "test_helper.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const int size = 256;
+
+template <typename float_type>
+void test_int16(void)
+{
+    aligned_array<float_type, size> in, generic, simd;
+    randomize_buffer<float_type>(in.c_array(), size, 2.4, -1.2);
+    in[0] = 1;
+    in[1] = -1;
+    in[2] = float_type(0.5 / 32768);
+
+    int16_t generic_pcm[size], simd_pcm[size];
+    float_to_int16_vec(generic_pcm, in.c_array(), size);
+    float_to_int16_vec_simd(simd_pcm, in.c_array(), size);
+
+    for (int i = 0; i != size; ++i) {
+        BOOST_REQUIRE_EQUAL( generic_pcm[i], simd_pcm[i] );
+        const double expected = floor(max(-32768.0, min(32767.0, double(in[i]) * 32768)) + 0.5);
+        BOOST_REQUIRE_EQUAL( int(simd_pcm[i]), int(expected) );
+    }
+    BOOST_CHECK_EQUAL( simd_pcm[0], 32767 );
+    BOOST_CHECK_EQUAL( simd_pcm[1], -32768 );
+
+    int16_to_float_vec(generic.c_array(), simd_pcm, size);
+    int16_to_float_vec_simd(simd.c_array(), simd_pcm, size);
+    for (int i = 0; i != size; ++i) {
+        BOOST_REQUIRE_EQUAL( generic[i], simd[i] );
+        BOOST_REQUIRE_EQUAL( simd[i], float_type(simd_pcm[i]) / float_type(32768) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( int16_tests )
+{
+    test_int16<float>();
+    test_int16<double>();
+}
+
+template <typename float_type>
+void test_int24(void)
+{
+    aligned_array<float_type, size> in, generic, simd;
+    randomize_buffer<float_type>(in.c_array(), size, 2, -1);
+    in[0] = 2;
+    in[1] = -2;
+
+    uint8_t generic_pcm[3 * size], simd_pcm[3 * size];
+    float_to_int24_vec(generic_pcm, in.c_array(), size);
+    float_to_int24_vec_simd(simd_pcm, in.c_array(), size);
+
+    for (int i = 0; i != 3 * size; ++i)
+        BOOST_REQUIRE_EQUAL( generic_pcm[i], simd_pcm[i] );
+
+    /* little endian, saturated */
+    BOOST_CHECK_EQUAL( simd_pcm[0], 0xff );
+    BOOST_CHECK_EQUAL( simd_pcm[1], 0xff );
+    BOOST_CHECK_EQUAL( simd_pcm[2], 0x7f );
+    BOOST_CHECK_EQUAL( simd_pcm[3], 0x00 );
+    BOOST_CHECK_EQUAL( simd_pcm[4], 0x00 );
+    BOOST_CHECK_EQUAL( simd_pcm[5], 0x80 );
+
+    int24_to_float_vec(generic.c_array(), simd_pcm, size);
+    int24_to_float_vec_simd(simd.c_array(), simd_pcm, size);
+    for (int i = 0; i != size; ++i) {
+        BOOST_REQUIRE_EQUAL( generic[i], simd[i] );
+        const float_type expected = max(float_type(-1), min(in[i], float_type(8388607) / float_type(8388608)));
+        BOOST_REQUIRE_SMALL( simd[i] - expected, float_type(1.0 / 8388608) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( int24_tests )
+{
+    test_int24<float>();
+    test_int24<double>();
+}
+
+template <typename float_type>
+void test_int32(void)
+{
+    aligned_array<float_type, size> in, generic, simd;
+    randomize_buffer<float_type>(in.c_array(), size, 2, -1);
+    in[0] = 4;
+    in[1] = -4;
+
+    int32_t generic_pcm[size], simd_pcm[size];
+    float_to_int32_vec(generic_pcm, in.c_array(), size);
+    float_to_int32_vec_simd(simd_pcm, in.c_array(), size);
+
+    for (int i = 0; i != size; ++i)
+        BOOST_REQUIRE_EQUAL( generic_pcm[i], simd_pcm[i] );
+    BOOST_CHECK_GT( simd_pcm[0], 2147483000 );
+    BOOST_CHECK_EQUAL( simd_pcm[1], int32_t(-2147483647 - 1) );
+
+    int32_to_float_vec(generic.c_array(), simd_pcm, size);
+    int32_to_float_vec_simd(simd.c_array(), simd_pcm, size);
+    for (int i = 2; i != size; ++i) {
+        BOOST_REQUIRE_EQUAL( generic[i], simd[i] );
+        BOOST_REQUIRE_SMALL( simd[i] - in[i], float_type(1e-6) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( int32_tests )
+{
+    test_int32<float>();
+    test_int32<double>();
+}
+
+template <typename float_type>
+void test_dither(pcm_dither_type type)
+{
+    const int blocks = 64;
+    aligned_array<float_type, size> in;
+    for (int i = 0; i != size; ++i)
+        in[i] = float_type(0.25 / 32768);
+
+    pcm_dither<float_type> generic(type, 5), simd(type, 5);
+    int16_t generic_pcm[size], simd_pcm[size];
+
+    /* the average of the dithered signal is the input signal */
+    double sum = 0, difference_sum = 0, squared_sum = 0;
+    for (int block = 0; block != blocks; ++block) {
+        generic.float_to_int16(generic_pcm, in.c_array(), size);
+        simd.float_to_int16_simd(simd_pcm, in.c_array(), size);
+
+        for (int i = 0; i != size; ++i) {
+            BOOST_REQUIRE_EQUAL( generic_pcm[i], simd_pcm[i] );
+            BOOST_REQUIRE( simd_pcm[i] >= -1 && simd_pcm[i] <= 1 );
+            sum += simd_pcm[i];
+            squared_sum += simd_pcm[i] * simd_pcm[i];
+            if (i)
+                difference_sum += (simd_pcm[i] - simd_pcm[i-1]) * (simd_pcm[i] - simd_pcm[i-1]);
+        }
+    }
+
+    const int count = blocks * size;
+    const double mean = sum / count;
+    BOOST_CHECK_SMALL( mean - 0.25, 0.03 );
+
+    /* highpass dither: neighboring samples are negatively correlated */
+    const double variance = squared_sum / count - mean * mean;
+    const double difference_variance = difference_sum / (count - blocks);
+    if (type == tpdf_dither)
+        BOOST_CHECK_CLOSE( difference_variance, 2 * variance, 10 );
+    else
+        BOOST_CHECK_GT( difference_variance, 2.4 * variance );
+}
+
+BOOST_AUTO_TEST_CASE( dither_tests )
+{
+    test_dither<float>(tpdf_dither);
+    test_dither<double>(tpdf_dither);
+    test_dither<float>(highpass_tpdf_dither);
+    test_dither<double>(highpass_tpdf_dither);
+}
@@ -3,6 +3,7 @@
 #include <boost/test/included/unit_test.hpp>
 #include <boost/test/floating_point_comparison.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 #include "../benchmarks/cache_aligned_array.hpp"
@@ -66,3 +67,136 @@ BOOST_AUTO_TEST_CASE( peak_test_double )
 {
     run_peak<double>();
 }
+
+/* compare against a brute force search, using blocks of varying size */
+template <typename F>
+void run_sliding_window(unsigned int window)
+{
+    const int length = 1000;
+    aligned_array<F, length> in, maximum, minimum, maximum_simd, minimum_simd;
+    unsigned int seed = 1;
+    for (int i = 0; i != length; ++i) {
+        seed = seed * 1103515245 + 12345;
+        in[i] = F(int((seed >> 16) & 0x7fff) - 0x4000);
+    }
+
+    sliding_window_max<F> max_generic(window), max_simd(window);
+    sliding_window_min<F> min_generic(window), min_simd(window);
+    BOOST_REQUIRE_EQUAL( max_simd.window(), window );
+
+    for (int offset = 0, block = 1; offset < length; offset += block, block = block * 3 % 67 + 1) {
+        const unsigned int n = std::min(block, length - offset);
+        max_generic.process(maximum.begin() + offset, in.begin() + offset, n);
+        max_simd.process_simd(maximum_simd.begin() + offset, in.begin() + offset, n);
+        min_generic.process(minimum.begin() + offset, in.begin() + offset, n);
+        min_simd.process_simd(minimum_simd.begin() + offset, in.begin() + offset, n);
+    }
+
+    for (int i = 0; i != length; ++i) {
+        const int begin = std::max(0, i - int(window) + 1);
+        const F expected_max = *std::max_element(in.begin() + begin, in.begin() + i + 1);
+        const F expected_min = *std::min_element(in.begin() + begin, in.begin() + i + 1);
+
+        BOOST_REQUIRE_EQUAL( maximum[i], expected_max );
+        BOOST_REQUIRE_EQUAL( maximum_simd[i], expected_max );
+        BOOST_REQUIRE_EQUAL( minimum[i], expected_min );
+        BOOST_REQUIRE_EQUAL( minimum_simd[i], expected_min );
+    }
+
+    /* in-place processing after reset */
+    max_simd.reset();
+    aligned_array<F, length> inplace = in;
+    max_simd.process_simd(inplace.begin(), inplace.begin(), length);
+    for (int i = 0; i != length; ++i) {
+        const int begin = std::max(0, i - int(window) + 1);
+        BOOST_REQUIRE_EQUAL( inplace[i], *std::max_element(in.begin() + begin, in.begin() + i + 1) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( sliding_window_test )
+{
+    const unsigned int windows[] = {1, 2, 3, 7, 16, 64, 100, 1500};
+    for (int i = 0; i != 8; ++i) {
+        run_sliding_window<float>(windows[i]);
+        run_sliding_window<double>(windows[i]);
+    }
+}
+
+/* batched metering matches the single channel functions */
+template <typename F>
+void run_batched_peak_rms(void)
+{
+    const int channels = 11;
+    aligned_array<F, size * channels> input;
+    const F * in[channels];
+    for (int channel = 0; channel != channels; ++channel)
+        in[channel] = input.begin() + channel * size;
+
+    F peaks[channels], sums[channels], simd_peaks[channels], simd_sums[channels];
+    for (int channel = 0; channel != channels; ++channel)
+        peaks[channel] = sums[channel] = simd_peaks[channel] = simd_sums[channel] = F(0.25);
+
+    for (int channel = 0; channel != channels; ++channel)
+        for (int i = 0; i != size; ++i)
+            input[channel * size + i] = F(((i * 7 + channel * 3) % 23) - 11) / F(4 + channel);
+
+    nova::peak_rms_vec<F>(in, peaks, sums, channels, size);
+    nova::peak_rms_vec_simd<F>(in, simd_peaks, simd_sums, channels, size);
+
+    for (int channel = 0; channel != channels; ++channel) {
+        F peak = F(0.25), sum = F(0.25);
+        nova::peak_rms_vec<F>(in[channel], &peak, &sum, size);
+
+        BOOST_REQUIRE_EQUAL( peaks[channel], peak );
+        BOOST_REQUIRE_EQUAL( simd_peaks[channel], peak );
+        BOOST_REQUIRE_CLOSE( sums[channel], sum, 1e-4 );
+        BOOST_REQUIRE_CLOSE( simd_sums[channel], sum, 1e-4 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( batched_peak_rms_test )
+{
+    run_batched_peak_rms<float>();
+    run_batched_peak_rms<double>();
+}
+
+/* peaks are held, then decay */
+template <typename F>
+void run_peak_decay_hold(void)
+{
+    const int channels = 6;
+    aligned_array<F, size * channels> input;
+    const F * in[channels];
+    for (int channel = 0; channel != channels; ++channel)
+        in[channel] = input.begin() + channel * size;
+
+    F peaks[channels], sums[channels], hold[channels];
+    F simd_peaks[channels], simd_sums[channels], simd_hold[channels];
+    for (int channel = 0; channel != channels; ++channel)
+        peaks[channel] = sums[channel] = hold[channel] = simd_peaks[channel] = simd_sums[channel] = simd_hold[channel] = 0;
+
+    for (int block = 0; block != 8; ++block) {
+        input.assign(0);
+        if (block == 0)
+            for (int channel = 0; channel != channels; ++channel)
+                input[channel * size + 5] = F(channel + 1);
+
+        nova::peak_rms_vec<F>(in, peaks, sums, hold, F(2), F(0.5), channels, size);
+        nova::peak_rms_vec_simd<F>(in, simd_peaks, simd_sums, simd_hold, F(2), F(0.5), channels, size);
+
+        /* held during the calls 1 and 2, decaying afterwards */
+        const F expected_factor = block <= 2 ? F(1) : F(std::pow(0.5, block - 2));
+        for (int channel = 0; channel != channels; ++channel) {
+            BOOST_REQUIRE_EQUAL( peaks[channel], F(channel + 1) * expected_factor );
+            BOOST_REQUIRE_EQUAL( simd_peaks[channel], F(channel + 1) * expected_factor );
+            BOOST_REQUIRE_EQUAL( simd_hold[channel], hold[channel] );
+            BOOST_REQUIRE_EQUAL( simd_sums[channel], sums[channel] );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( peak_decay_hold_test )
+{
+    run_peak_decay_hold<float>();
+    run_peak_decay_hold<double>();
+}
@@ -0,0 +1,121 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "../simd_resampler.hpp"
+#include "test_helper.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const int size = 512;
+static const int blocks = 32;
+static const double two_pi = 6.283185307179586476925286766559;
+
+/* resample a 1 kHz sine and compare with the ideal output */
+template <typename float_type>
+void check_sine(resampler<float_type> & r, double input_rate, double output_rate, double tolerance, bool simd)
+{
+    const double frequency = 1000;
+    std::vector<float_type> in(size);
+    std::vector<float_type> out(r.max_output_size(size));
+
+    int input_index = 0, output_index = 0;
+    for (int block = 0; block != blocks; ++block) {
+        for (int i = 0; i != size; ++i, ++input_index)
+            in[i] = float_type(sin(two_pi * frequency * input_index / input_rate));
+
+        const unsigned int produced = simd ? r.process_simd(&in.front(), size, &out.front())
+                                           : r.process(&in.front(), size, &out.front());
+        BOOST_REQUIRE_LE( produced, out.size() );
+
+        for (unsigned int i = 0; i != produced; ++i, ++output_index) {
+            /* the signal starts with a step, skip the transient */
+            if (output_index < int(r.taps() * output_rate / input_rate))
+                continue;
+            const double expected = sin(two_pi * frequency * output_index / output_rate);
+            BOOST_REQUIRE_SMALL( double(out[i]) - expected, tolerance );
+        }
+    }
+
+    /* all outputs are available after latency() further input samples */
+    const double expected_outputs = (input_index - r.latency()) * output_rate / input_rate;
+    BOOST_CHECK_SMALL( output_index - expected_outputs, 2.0 );
+}
+
+template <typename float_type>
+void test_rational(void)
+{
+    const unsigned int rates[][2] = {
+        { 44100, 48000 }, { 48000, 44100 }, { 48000, 96000 }, { 96000, 48000 }, { 44100, 192000 }
+    };
+
+    for (int i = 0; i != 5; ++i) {
+        resampler<float_type> generic(rates[i][0], rates[i][1], size, resampler_high_quality);
+        resampler<float_type> simd(rates[i][0], rates[i][1], size, resampler_high_quality);
+        BOOST_CHECK( generic.is_rational() );
+
+        check_sine(generic, rates[i][0], rates[i][1], 1e-3, false);
+        check_sine(simd, rates[i][0], rates[i][1], 1e-3, true);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( resampler_rational_tests )
+{
+    test_rational<float>();
+    test_rational<double>();
+}
+
+template <typename float_type>
+void test_arbitrary(void)
+{
+    const double ratios[] = { 1.2345, 0.7071, 3.1 };
+    for (int i = 0; i != 3; ++i) {
+        resampler<float_type> r(ratios[i], size, resampler_high_quality);
+        BOOST_CHECK( !r.is_rational() );
+        check_sine(r, 48000, 48000 * ratios[i], 2e-3, true);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( resampler_arbitrary_tests )
+{
+    test_arbitrary<float>();
+    test_arbitrary<double>();
+}
+
+/* the output does not depend on the block sizes */
+template <typename float_type>
+void test_streaming(void)
+{
+    const int total = size * 4;
+    std::vector<float_type> in(total);
+    randomize_buffer<float_type>(&in.front(), total, 2, -1);
+
+    resampler<float_type> whole(44100, 48000, total), blocked(44100, 48000, total);
+    std::vector<float_type> reference(whole.max_output_size(total)), out(reference.size());
+
+    const unsigned int reference_size = whole.process_simd(&in.front(), total, &reference.front());
+
+    unsigned int produced = 0;
+    int consumed = 0;
+    const int block_sizes[] = { 1, 17, 64, 3, 500, 129 };
+    for (int i = 0; consumed != total; ++i) {
+        const int n = std::min(block_sizes[i % 6], total - consumed);
+        produced += blocked.process_simd(&in[consumed], n, &out[produced]);
+        consumed += n;
+    }
+
+    BOOST_REQUIRE_EQUAL( produced, reference_size );
+    for (unsigned int i = 0; i != produced; ++i)
+        BOOST_REQUIRE_CLOSE( out[i], reference[i], 0.0001 );
+}
+
+BOOST_AUTO_TEST_CASE( resampler_streaming_tests )
+{
+    test_streaming<float>();
+    test_streaming<double>();
+}
@@ -45,4 +45,45 @@ COMPARE_TEST(round)
 COMPARE_TEST(ceil)
 COMPARE_TEST(floor)
 COMPARE_TEST(frac)
-COMPARE_TEST(trunc)
\ No newline at end of file
+COMPARE_TEST(trunc)
+
+/* values that are already integral (|x| >= 2^23 for float, 2^52 for double), infinities and nan are
+ * returned unchanged */
+template <typename float_type>
+void test_round_large(void)
+{
+    const float_type large = float_type(std::numeric_limits<float_type>::digits == 24 ? 0x1.0p23 : 0x1.0p52);
+    const float_type special[] = {
+        large, large + 1, large * 2 + 2, large * 4 + 12, float_type(1e30), std::numeric_limits<float_type>::max(),
+        std::numeric_limits<float_type>::infinity(), std::numeric_limits<float_type>::quiet_NaN()
+    };
+    const int count = sizeof(special) / sizeof(special[0]);
+
+    aligned_array<float_type, 64> args, rounded, floored, ceiled;
+    for (int i = 0; i != 64; ++i) {
+        const float_type value = special[(i / 2) % count];
+        args[i] = (i % 2) ? -value : value;
+    }
+
+    round_vec_simd(rounded.c_array(), args.c_array(), 64);
+    floor_vec_simd(floored.c_array(), args.c_array(), 64);
+    ceil_vec_simd(ceiled.c_array(), args.c_array(), 64);
+
+    for (int i = 0; i != 64; ++i) {
+        if (std::isnan(args[i])) {
+            BOOST_REQUIRE( std::isnan(rounded[i]) );
+            BOOST_REQUIRE( std::isnan(floored[i]) );
+            BOOST_REQUIRE( std::isnan(ceiled[i]) );
+        } else {
+            BOOST_REQUIRE_EQUAL( rounded[i], args[i] );
+            BOOST_REQUIRE_EQUAL( floored[i], std::floor(args[i]) );
+            BOOST_REQUIRE_EQUAL( ceiled[i], std::ceil(args[i]) );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( round_large_tests )
+{
+    test_round_large<float>();
+    test_round_large<double>();
+}
@@ -0,0 +1,109 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+
+#include "../simd_true_peak.hpp"
+#include "../simd_peakmeter.hpp"
+#include "test_helper.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const int size = 64;
+static const double two_pi = 6.283185307179586476925286766559;
+
+/* a sine at a quarter of the sampling rate, sampled 45 degrees off its peaks: the sample peak
+ * underestimates the true peak by 3 dB */
+template <typename float_type>
+void test_quarter_sine(void)
+{
+    true_peak_meter<float_type> generic, simd;
+    aligned_array<float_type, size> in;
+
+    float_type sample_peak = 0;
+    for (int block = 0; block != 8; ++block) {
+        for (int i = 0; i != size; ++i)
+            in[i] = float_type(sin(two_pi * 0.25 * (block * size + i) + two_pi / 8));
+
+        peak_vec_simd(in.c_array(), &sample_peak, size);
+        const float_type generic_block = generic.process(in.c_array(), size);
+        const float_type simd_block = simd.process_simd(in.c_array(), size);
+        BOOST_REQUIRE_CLOSE( generic_block, simd_block, 1e-3 );
+
+        /* skip the onset */
+        if (block == 0) {
+            generic.reset_peak();
+            simd.reset_peak();
+        }
+    }
+
+    BOOST_REQUIRE_CLOSE( sample_peak, float_type(sqrt(0.5)), 1e-3 );
+    BOOST_REQUIRE_CLOSE( generic.peak(), float_type(1), 1.0 );
+    BOOST_REQUIRE_CLOSE( simd.peak(), float_type(1), 1.0 );
+
+    simd.reset_peak();
+    BOOST_REQUIRE_EQUAL( simd.peak(), float_type(0) );
+}
+
+BOOST_AUTO_TEST_CASE( quarter_sine_tests )
+{
+    test_quarter_sine<float>();
+    test_quarter_sine<double>();
+}
+
+/* the true peak is never below the sample peak, the error is below 0.05 dB up to 0.4 times
+ * the sampling rate */
+template <typename float_type>
+void test_sweep(void)
+{
+    for (int step = 0; step != 16; ++step) {
+        const double frequency = 0.02 + 0.025 * step;
+        true_peak_meter<float_type> meter;
+        aligned_array<float_type, size> in;
+        float_type sample_peak = 0;
+
+        for (int block = 0; block != 16; ++block) {
+            for (int i = 0; i != size; ++i)
+                in[i] = float_type(0.5 * sin(two_pi * frequency * (block * size + i) + 0.3));
+            peak_vec_simd(in.c_array(), &sample_peak, size);
+            meter.process_simd(in.c_array(), size);
+            if (block == 0)
+                meter.reset_peak();
+        }
+
+        BOOST_REQUIRE_GE( meter.peak(), sample_peak * float_type(0.9999) );
+        BOOST_REQUIRE_SMALL( double(meter.peak()) - 0.5, 0.0025 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( sweep_tests )
+{
+    test_sweep<float>();
+    test_sweep<double>();
+}
+
+/* the history is kept across blocks: a single impulse rings into the next block */
+template <typename float_type>
+void test_streaming(void)
+{
+    true_peak_meter<float_type> meter;
+    aligned_array<float_type, size> in;
+    in.assign(0);
+    in[size - 1] = 1;
+
+    /* the interpolated impulse only reaches the center taps in the next block */
+    BOOST_REQUIRE_LT( meter.process_simd(in.c_array(), size), float_type(0.1) );
+    in.assign(0);
+    BOOST_REQUIRE_CLOSE( meter.process_simd(in.c_array(), size), float_type(1), 1e-3 );
+    BOOST_REQUIRE_EQUAL( meter.latency(), 5u );
+}
+
+BOOST_AUTO_TEST_CASE( streaming_tests )
+{
+    test_streaming<float>();
+    test_streaming<double>();
+}
@@ -0,0 +1,220 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+
+#include "../simd_vbap.hpp"
+#include "test_helper.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const int size = 64;
+
+/* front, left, back, right, top, bottom */
+static const float octahedron_azimuth[] = {0, 90, 180, 270, 0, 0};
+static const float octahedron_elevation[] = {0, 0, 0, 0, 90, -90};
+
+template <typename float_type>
+void test_octahedron(void)
+{
+    float_type azimuth[6], elevation[6];
+    std::copy(octahedron_azimuth, octahedron_azimuth + 6, azimuth);
+    std::copy(octahedron_elevation, octahedron_elevation + 6, elevation);
+
+    vbap_panner<float_type> panner(azimuth, elevation, 6, 1);
+    BOOST_REQUIRE_EQUAL( panner.triplets(), 8u );
+
+    /* on a speaker */
+    panner.set_direction(0, 90, 0);
+    panner.reset();
+    for (unsigned int speaker = 0; speaker != 6; ++speaker)
+        BOOST_REQUIRE_SMALL( panner.gain(0, speaker) - float_type(speaker == 1 ? 1 : 0), float_type(1e-5) );
+
+    /* center of the face front, left, top */
+    panner.set_direction(0, 45, float_type(35.26438968275466));
+    panner.reset();
+    for (unsigned int speaker = 0; speaker != 6; ++speaker) {
+        const bool active = speaker == 0 || speaker == 1 || speaker == 4;
+        BOOST_REQUIRE_SMALL( panner.gain(0, speaker) - float_type(active ? sqrt(1.0 / 3) : 0), float_type(1e-5) );
+    }
+
+    /* between two speakers */
+    panner.set_direction(0, 225, 0);
+    panner.reset();
+    BOOST_REQUIRE_CLOSE( panner.gain(0, 2), float_type(sqrt(0.5)), 1e-3 );
+    BOOST_REQUIRE_CLOSE( panner.gain(0, 3), float_type(sqrt(0.5)), 1e-3 );
+}
+
+BOOST_AUTO_TEST_CASE( octahedron_tests )
+{
+    test_octahedron<float>();
+    test_octahedron<double>();
+}
+
+/* dome of 8 + 4 + 1 speakers, without speakers below the horizon */
+template <typename float_type>
+void test_dome(void)
+{
+    float_type azimuth[13], elevation[13];
+    for (int i = 0; i != 8; ++i) {
+        azimuth[i] = float_type(45 * i);
+        elevation[i] = 0;
+    }
+    for (int i = 0; i != 4; ++i) {
+        azimuth[8 + i] = float_type(45 + 90 * i);
+        elevation[8 + i] = 45;
+    }
+    azimuth[12] = 0;
+    elevation[12] = 90;
+
+    vbap_panner<float_type> panner(azimuth, elevation, 13, 1);
+    BOOST_REQUIRE( panner.triplets() > 0 );
+
+    for (int az = 0; az < 360; az += 15) {
+        for (int el = -60; el <= 90; el += 15) {
+            panner.set_direction(0, float_type(az), float_type(el));
+            panner.reset();
+
+            float_type power = 0;
+            for (unsigned int speaker = 0; speaker != 13; ++speaker) {
+                const float_type gain = panner.gain(0, speaker);
+                BOOST_REQUIRE_GE( gain, float_type(0) );
+                power += gain * gain;
+            }
+            BOOST_REQUIRE_CLOSE( power, float_type(1), 1e-3 );
+
+            /* directions on the horizon only use the horizontal ring, directions below are mapped to
+             * the closest triplet */
+            if (el == 0 && az % 45 == 0)
+                BOOST_REQUIRE_CLOSE( panner.gain(0, az / 45), float_type(1), 1e-3 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( dome_tests )
+{
+    test_dome<float>();
+    test_dome<double>();
+}
+
+/* panning above the horizontal ring only uses the layers above it */
+template <typename float_type>
+void check_layers(vbap_panner<float_type> & panner, const float_type * elevation, float_type azimuth,
+                  float_type source_elevation, float_type lowest)
+{
+    panner.set_direction(0, azimuth, source_elevation);
+    panner.reset();
+
+    float_type power = 0;
+    for (unsigned int speaker = 0; speaker != panner.speakers(); ++speaker) {
+        const float_type gain = panner.gain(0, speaker);
+        BOOST_REQUIRE_GE( gain, float_type(0) );
+        if (elevation[speaker] < lowest)
+            BOOST_REQUIRE_EQUAL( gain, float_type(0) );
+        power += gain * gain;
+    }
+    BOOST_REQUIRE_CLOSE( power, float_type(1), 1e-3 );
+}
+
+/* layouts with more than 3 coplanar speakers on a hull face. without overlaps, the hull of v
+ * speakers has 2 v - 4 triangles, of which the ignored horizontal ring of r speakers takes r - 2 */
+template <typename float_type>
+void test_coplanar(void)
+{
+    /* 7.0.4: horizontal ring and a square of 4 ceiling speakers */
+    const float_type azimuth_714[] = {0, 30, -30, 90, -90, 135, -135, 45, -45, 135, -135};
+    const float_type elevation_714[] = {0, 0, 0, 0, 0, 0, 0, 45, 45, 45, 45};
+
+    vbap_panner<float_type> panner_714(azimuth_714, elevation_714, 11, 1);
+    BOOST_REQUIRE_EQUAL( panner_714.triplets(), 2 * 11 - 4 - (7 - 2) );
+
+    check_layers(panner_714, elevation_714, float_type(0), float_type(80), float_type(45));
+    check_layers(panner_714, elevation_714, float_type(90), float_type(60), float_type(45));
+
+    /* two rings of 8 speakers at 0 and 30 degrees, the sides and the top are coplanar */
+    float_type azimuth_88[16], elevation_88[16];
+    for (int i = 0; i != 8; ++i) {
+        azimuth_88[i] = azimuth_88[8 + i] = float_type(45 * i);
+        elevation_88[i] = 0;
+        elevation_88[8 + i] = 30;
+    }
+
+    vbap_panner<float_type> panner_88(azimuth_88, elevation_88, 16, 1);
+    BOOST_REQUIRE_EQUAL( panner_88.triplets(), 2 * 16 - 4 - (8 - 2) );
+
+    check_layers(panner_88, elevation_88, float_type(10), float_type(40), float_type(30));
+    check_layers(panner_88, elevation_88, float_type(200), float_type(70), float_type(30));
+}
+
+BOOST_AUTO_TEST_CASE( coplanar_tests )
+{
+    test_coplanar<float>();
+    test_coplanar<double>();
+}
+
+/* gains are interpolated per sample, only the active buses are touched */
+template <typename float_type>
+void test_process(void)
+{
+    const int sources = 3;
+    const int speakers = 6;
+    float_type azimuth[6], elevation[6];
+    std::copy(octahedron_azimuth, octahedron_azimuth + 6, azimuth);
+    std::copy(octahedron_elevation, octahedron_elevation + 6, elevation);
+
+    vbap_panner<float_type> generic(azimuth, elevation, speakers, sources), simd(azimuth, elevation, speakers, sources);
+
+    aligned_array<float_type, size * sources> input;
+    aligned_array<float_type, size * speakers> generic_buses, simd_buses;
+    const float_type * in[sources];
+    float_type * generic_out[speakers], * simd_out[speakers];
+    for (int source = 0; source != sources; ++source)
+        in[source] = input.c_array() + source * size;
+    for (int speaker = 0; speaker != speakers; ++speaker) {
+        generic_out[speaker] = generic_buses.c_array() + speaker * size;
+        simd_out[speaker] = simd_buses.c_array() + speaker * size;
+    }
+
+    /* source 0: constant 1, moves from front to left; sources 1 and 2: noise at fixed positions */
+    for (int i = 0; i != size; ++i)
+        input[i] = 1;
+    randomize_buffer<float_type>(input.c_array() + size, 2 * size);
+
+    const float_type directions[sources][2] = {{0, 0}, {135, 30}, {160, -20}};
+    for (int source = 0; source != sources; ++source) {
+        generic.set_direction(source, directions[source][0], directions[source][1]);
+        simd.set_direction(source, directions[source][0], directions[source][1]);
+    }
+    generic.reset();
+    simd.reset();
+    generic.set_direction(0, 90, 0);
+    simd.set_direction(0, 90, 0);
+
+    generic_buses.assign(0);
+    simd_buses.assign(0);
+    generic.process(generic_out, in, size);
+    simd.process_simd(simd_out, in, size);
+
+    for (int i = 0; i != size * speakers; ++i)
+        BOOST_REQUIRE_SMALL( generic_buses[i] - simd_buses[i], float_type(1e-5) );
+
+    /* only source 0 reaches the front speaker, linear ramp from 1 to 0 */
+    for (int i = 0; i != size; ++i)
+        BOOST_REQUIRE_SMALL( simd_out[0][i] - float_type(1 - double(i) / size), float_type(1e-5) );
+
+    /* the right speaker is not used by any source */
+    for (int i = 0; i != size; ++i)
+        BOOST_REQUIRE_EQUAL( simd_out[3][i], float_type(0) );
+
+    BOOST_REQUIRE_CLOSE( simd.gain(0, 1), float_type(1), 1e-3 );
+}
+
+BOOST_AUTO_TEST_CASE( process_tests )
+{
+    test_process<float>();
+    test_process<double>();
+}
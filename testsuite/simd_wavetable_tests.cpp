@@ -0,0 +1,137 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "../simd_wavetable.hpp"
+#include "test_helper.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const int size = 64;
+static const int voices = 5;
+static const double two_pi = 6.283185307179586476925286766559;
+
+template <typename float_type>
+void test_wavetable_sine(interpolation_type type, float_type tolerance)
+{
+    const float_type amplitude = 1;
+    wavetable<float_type> table(&amplitude, 1);
+    wavetable_bank<float_type> bank(table, voices);
+
+    aligned_array<float_type, size * voices> out;
+    float_type * outs[voices];
+    for (int voice = 0; voice != voices; ++voice) {
+        outs[voice] = out.c_array() + voice * size;
+        bank.set_frequency(voice, float_type(0.003 + 0.041 * voice));
+        bank.set_phase(voice, float_type(0.1 * voice));
+    }
+
+    for (int block = 0; block != 8; ++block) {
+        bank.process(outs, size, type);
+
+        for (int voice = 0; voice != voices; ++voice) {
+            for (int i = 0; i != size; ++i) {
+                const double frequency = float_type(0.003 + 0.041 * voice);
+                const double phase = 0.1 * voice + frequency * (block * size + i);
+                BOOST_CHECK_SMALL( outs[voice][i] - float_type(sin(two_pi * phase)), tolerance );
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( wavetable_sine_tests )
+{
+    test_wavetable_sine<float>(linear_interpolation, 1e-4f);
+    test_wavetable_sine<float>(hermite_interpolation, 1e-5f);
+    test_wavetable_sine<float>(lagrange_interpolation, 1e-5f);
+    test_wavetable_sine<double>(linear_interpolation, 1e-5);
+    test_wavetable_sine<double>(hermite_interpolation, 1e-6);
+    test_wavetable_sine<double>(lagrange_interpolation, 1e-6);
+}
+
+template <typename float_type>
+void test_wavetable_mix(void)
+{
+    /* sawtooth */
+    std::vector<float_type> amplitudes(1024);
+    for (size_t h = 0; h != amplitudes.size(); ++h)
+        amplitudes[h] = float_type(1) / float_type(h + 1);
+
+    wavetable<float_type> table(&amplitudes.front(), amplitudes.size());
+    wavetable_bank<float_type> bank(table, voices), mix_bank(table, voices);
+
+    aligned_array<float_type, size * voices> out;
+    aligned_array<float_type, size> mix;
+    float_type * outs[voices];
+    for (int voice = 0; voice != voices; ++voice) {
+        outs[voice] = out.c_array() + voice * size;
+        const float_type frequency = float_type(0.0007 * (voice + 1) * (voice + 1));
+        bank.set_frequency(voice, frequency);
+        mix_bank.set_frequency(voice, frequency);
+        bank.set_amplitude(voice, float_type(0.5) / (voice + 1));
+        mix_bank.set_amplitude(voice, float_type(0.5) / (voice + 1));
+    }
+
+    for (int block = 0; block != 4; ++block) {
+        bank.process(outs, size, hermite_interpolation);
+        mix_bank.process_mix(mix.c_array(), size, hermite_interpolation);
+
+        for (int i = 0; i != size; ++i) {
+            float_type sum = 0;
+            for (int voice = 0; voice != voices; ++voice)
+                sum += outs[voice][i];
+            BOOST_CHECK_SMALL( mix[i] - sum, float_type(1e-4) );
+        }
+    }
+
+    for (int voice = 0; voice != voices; ++voice)
+        BOOST_CHECK_SMALL( bank.phase(voice) - mix_bank.phase(voice), float_type(1e-7) );
+}
+
+BOOST_AUTO_TEST_CASE( wavetable_mix_tests )
+{
+    test_wavetable_mix<float>();
+    test_wavetable_mix<double>();
+}
+
+BOOST_AUTO_TEST_CASE( wavetable_mip_level_tests )
+{
+    std::vector<float> amplitudes(1024, 1.f);
+    wavetable<float> table(&amplitudes.front(), amplitudes.size(), 2048);
+
+    BOOST_REQUIRE_EQUAL( table.levels(), 10u );
+
+    const float increments[] = { 0.0001f, 0.001f, 0.01f, 0.1f, 0.25f, 0.45f };
+    for (int i = 0; i != 6; ++i) {
+        const unsigned int level = table.level_for_increment(increments[i]);
+        const unsigned int highest_harmonic = 2048 >> (level + 2);
+        BOOST_CHECK_LE( highest_harmonic * increments[i], 0.5f );
+        if (level)
+            BOOST_CHECK_GT( 2 * highest_harmonic * increments[i], 0.5f );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( wavetable_phase_tests )
+{
+    const float amplitude = 1;
+    wavetable<float> table(&amplitude, 1);
+    wavetable_bank<float> bank(table, 1);
+    bank.set_frequency(0, 0.01234f);
+
+    aligned_array<float, size> out;
+    float * outs[1] = { out.c_array() };
+
+    /* one second at 48 kHz does not accumulate audible phase errors */
+    const int iterations = 750;
+    for (int i = 0; i != iterations; ++i)
+        bank.process(outs, size);
+
+    const double expected = fmod(double(0.01234f) * iterations * size, 1.0);
+    BOOST_CHECK_SMALL( double(bank.phase(0)) - expected, 1e-5 );
+}
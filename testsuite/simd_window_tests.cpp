@@ -0,0 +1,144 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+
+#include "../simd_window.hpp"
+#include "test_helper.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const int size = 1022;
+
+static double bessel_i0(double x)
+{
+    double term = 1, sum = 1;
+    for (int k = 1; k != 100; ++k) {
+        term *= (x * x * 0.25) / (k * k);
+        sum += term;
+    }
+    return sum;
+}
+
+static double reference_window(window_type type, int i, int n, double parameter, bool periodic)
+{
+    const double period = periodic ? n : n - 1;
+    const double x = 2 * M_PI * i / period;
+    const double r = 2.0 * i / period - 1;
+
+    switch (type) {
+    case rectangular_window:
+        return 1;
+    case hann_window:
+        return 0.5 - 0.5 * cos(x);
+    case hamming_window:
+        return 0.54 - 0.46 * cos(x);
+    case blackman_harris_window:
+        return 0.35875 - 0.48829 * cos(x) + 0.14128 * cos(2 * x) - 0.01168 * cos(3 * x);
+    case kaiser_window:
+        return bessel_i0(parameter * sqrt(max(0., 1 - r * r))) / bessel_i0(parameter);
+    case gaussian_window:
+        return exp(-0.5 * (r / parameter) * (r / parameter));
+    }
+    return 0;
+}
+
+template <typename float_type>
+void test_window(window_type type, float_type parameter, bool periodic)
+{
+    aligned_array<float_type, size> window;
+    make_window<float_type>(window.c_array(), type, size, parameter, periodic);
+
+    for (int i = 0; i != size; ++i)
+        BOOST_REQUIRE_SMALL( window[i] - float_type(reference_window(type, i, size, parameter, periodic)),
+                             float_type(2e-5) );
+}
+
+template <typename float_type>
+void test_windows(void)
+{
+    for (int periodic = 0; periodic != 2; ++periodic) {
+        test_window<float_type>(rectangular_window, 0, periodic);
+        test_window<float_type>(hann_window, 0, periodic);
+        test_window<float_type>(hamming_window, 0, periodic);
+        test_window<float_type>(blackman_harris_window, 0, periodic);
+        test_window<float_type>(kaiser_window, 8.6, periodic);
+        test_window<float_type>(gaussian_window, 0.4, periodic);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( window_tests )
+{
+    test_windows<float>();
+    test_windows<double>();
+}
+
+template <typename float_type>
+void test_window_cache(void)
+{
+    window_cache<float_type> cache;
+
+    const float_type * hann = cache.get(hann_window, 1000);
+    const float_type * kaiser = cache.get(kaiser_window, 1000, 6);
+
+    BOOST_REQUIRE( hann != kaiser );
+    BOOST_REQUIRE_EQUAL( cache.get(hann_window, 1000), hann );
+    BOOST_REQUIRE_EQUAL( cache.get(kaiser_window, 1000, 6), kaiser );
+    BOOST_REQUIRE( cache.get(kaiser_window, 1000, 7) != kaiser );
+    BOOST_REQUIRE( cache.get(hann_window, 1024) != hann );
+    BOOST_REQUIRE_EQUAL( cache.size(), 4u );
+
+    BOOST_REQUIRE( vec<float_type>::is_aligned(const_cast<float_type*>(hann)) );
+
+    /* padding */
+    const float_type * odd = cache.get(hann_window, 1001);
+    for (int i = 1001; i % vec<float_type>::objects_per_cacheline; ++i)
+        BOOST_REQUIRE_EQUAL( odd[i], 0 );
+
+    cache.clear();
+    BOOST_REQUIRE_EQUAL( cache.size(), 0u );
+}
+
+BOOST_AUTO_TEST_CASE( window_cache_tests )
+{
+    test_window_cache<float>();
+    test_window_cache<double>();
+}
+
+template <typename float_type>
+void test_window_copy(void)
+{
+    const int n = 512;
+    aligned_array<float_type, 2 * n> in;
+    aligned_array<float_type, 2 * n> generic, sseval;
+    aligned_array<float_type, n> window;
+    randomize_buffer<float_type>(in.c_array(), 2 * n);
+    make_window<float_type>(window.c_array(), hann_window, n);
+
+    generic.assign(1);
+    sseval.assign(1);
+
+    /* unaligned input */
+    window_copy_vec(generic.c_array(), in.c_array() + 1, window.c_array(), n, 2 * n);
+    window_copy_vec_simd(sseval.c_array(), in.c_array() + 1, window.c_array(), n, 2 * n);
+
+    for (int i = 0; i != n; ++i) {
+        BOOST_REQUIRE_CLOSE( generic[i], in[i + 1] * window[i], 0.0001 );
+        BOOST_REQUIRE_CLOSE( sseval[i], generic[i], 0.0001 );
+    }
+
+    for (int i = n; i != 2 * n; ++i) {
+        BOOST_REQUIRE_EQUAL( generic[i], 0 );
+        BOOST_REQUIRE_EQUAL( sseval[i], 0 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( window_copy_tests )
+{
+    test_window_copy<float>();
+    test_window_copy<double>();
+}
@@ -57,6 +57,23 @@ T min_(T const & left, T const & right)
     return std::min(left, right);
 }
 
+namespace detail {
+
+/* true, if VecType provides an integer vector type */
+template <typename VecType>
+struct has_int_vec
+{
+    template <typename T>
+    static char test(typename T::int_vec *);
+
+    template <typename T>
+    static long test(...);
+
+    static const bool value = sizeof(test<VecType>(0)) == 1;
+};
+
+}
+
 }
 
 #endif /* VEC_HPP */
@@ -374,6 +374,71 @@ public:
 
     /* @} */
 
+    /* @{ */
+    /** shuffles */
+
+    /* low = [lhs[0], rhs[0], lhs[1], rhs[1], ...], high continues with the upper halves */
+    friend inline void interleave(vec const & lhs, vec const & rhs, vec & low, vec & high)
+    {
+        low  = vec_mergeh(lhs.data_, rhs.data_);
+        high = vec_mergel(lhs.data_, rhs.data_);
+    }
+
+    /* inverse of interleave */
+    friend inline void deinterleave(vec const & low, vec const & high, vec & lhs, vec & rhs)
+    {
+        const __vector unsigned char even = (__vector unsigned char){ 0,  1,  2,  3,  8,  9, 10, 11,
+                                                                     16, 17, 18, 19, 24, 25, 26, 27};
+        const __vector unsigned char odd  = (__vector unsigned char){ 4,  5,  6,  7, 12, 13, 14, 15,
+                                                                     20, 21, 22, 23, 28, 29, 30, 31};
+        lhs = vec_perm(low.data_, high.data_, even);
+        rhs = vec_perm(low.data_, high.data_, odd);
+    }
+
+    /* lane i of the result is arg[max(i - count, 0)], lane 0 is repeated.
+     * count should be a compile-time constant, so that the switch folds to a single vsldoi */
+    friend inline vec shift_lanes_up(vec const & arg, unsigned int count)
+    {
+        const __vector float first = vec_splat(arg.data_, 0);
+
+        switch (count)
+        {
+        case 0:
+            return arg;
+
+        case 1:
+            return vec_sld(first, arg.data_, 12);
+
+        case 2:
+            return vec_sld(first, arg.data_, 8);
+
+        default:
+            return first;
+        }
+    }
+
+    /* lane i of the result is arg[min(i + count, size - 1)], the last lane is repeated */
+    friend inline vec shift_lanes_down(vec const & arg, unsigned int count)
+    {
+        const __vector float last = vec_splat(arg.data_, 3);
+
+        switch (count)
+        {
+        case 0:
+            return arg;
+
+        case 1:
+            return vec_sld(arg.data_, last, 4);
+
+        case 2:
+            return vec_sld(arg.data_, last, 8);
+
+        default:
+            return last;
+        }
+    }
+    /* @} */
+
     /* @{ */
     /** unary functions */
     friend inline vec abs(vec const & arg)
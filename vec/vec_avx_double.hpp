@@ -26,6 +26,7 @@
 
 #include "../detail/vec_math.hpp"
 #include "vec_base.hpp"
+#include "vec_int_sse2.hpp"
 
 #if defined(__GNUC__) && defined(NDEBUG)
 #define always_inline inline  __attribute__((always_inline))
@@ -145,6 +146,13 @@ public:
         data_ = _mm256_castpd128_pd256(_mm_load_sd(data));
     }
 
+#ifdef __AVX2__
+    void gather(const double * base, const int * indices)
+    {
+        data_ = _mm256_i32gather_pd(base, _mm_loadu_si128((const __m128i*)indices), 8);
+    }
+#endif
+
     void store(double * dest) const
     {
         _mm256_storeu_pd(dest, data_);
@@ -167,6 +175,41 @@ public:
 
     /* @} */
 
+    /* @{ */
+    /** integer io */
+    void load_int16(const int16_t * src)
+    {
+        data_ = _mm256_cvtepi32_pd(detail::int_vec_sse2::load_int16(src));
+    }
+
+    void load_int32(const int32_t * src)
+    {
+        data_ = _mm256_cvtepi32_pd(detail::int_vec_sse2::load_int32(src));
+    }
+
+    void store_int16(int16_t * dest) const
+    {
+        detail::int_vec_sse2(_mm256_cvttpd_epi32(data_)).store_int16(dest);
+    }
+
+    void store_int32(int32_t * dest) const
+    {
+        detail::int_vec_sse2(_mm256_cvttpd_epi32(data_)).store_int32(dest);
+    }
+
+#ifdef __SSSE3__
+    void load_int24(const uint8_t * src)
+    {
+        data_ = _mm256_cvtepi32_pd(detail::int_vec_sse2::load_int24(src));
+    }
+
+    void store_int24(uint8_t * dest) const
+    {
+        detail::int_vec_sse2(_mm256_cvttpd_epi32(data_)).store_int24(dest);
+    }
+#endif
+    /* @} */
+
     /* @{ */
     /** element access */
     void set_vec (double value)
@@ -287,6 +330,72 @@ public:
 
     /* @} */
 
+    /* @{ */
+    /** shuffles */
+
+    /* low = [lhs[0], rhs[0], lhs[1], rhs[1], ...], high continues with the upper halves */
+    friend inline void interleave(vec const & lhs, vec const & rhs, vec & low, vec & high)
+    {
+        /* unpack works on 128 bit lanes */
+        const __m256d lower = _mm256_unpacklo_pd(lhs.data_, rhs.data_);    /* [l0 r0 | l2 r2] */
+        const __m256d upper = _mm256_unpackhi_pd(lhs.data_, rhs.data_);    /* [l1 r1 | l3 r3] */
+        low  = _mm256_permute2f128_pd(lower, upper, 0x20);
+        high = _mm256_permute2f128_pd(lower, upper, 0x31);
+    }
+
+    /* inverse of interleave */
+    friend inline void deinterleave(vec const & low, vec const & high, vec & lhs, vec & rhs)
+    {
+        const __m256d lower = _mm256_permute2f128_pd(low.data_, high.data_, 0x20);    /* [l0 r0 | l2 r2] */
+        const __m256d upper = _mm256_permute2f128_pd(low.data_, high.data_, 0x31);    /* [l1 r1 | l3 r3] */
+        lhs = _mm256_unpacklo_pd(lower, upper);
+        rhs = _mm256_unpackhi_pd(lower, upper);
+    }
+
+    /* lane i of the result is arg[max(i - count, 0)], lane 0 is repeated.
+     * count should be a compile-time constant, so that the switch folds */
+    friend inline vec shift_lanes_up(vec const & arg, unsigned int count)
+    {
+        const __m256d lower = _mm256_permute2f128_pd(arg.data_, arg.data_, 0x00);    /* [a0 a1 | a0 a1] */
+
+        switch (count)
+        {
+        case 0:
+            return arg;
+
+        case 1:
+            return _mm256_shuffle_pd(lower, arg.data_, 0x4);                    /* [a0 a0 | a1 a2] */
+
+        case 2:
+            return _mm256_permute_pd(lower, 0x8);                               /* [a0 a0 | a0 a1] */
+
+        default:
+            return _mm256_permute_pd(lower, 0x0);
+        }
+    }
+
+    /* lane i of the result is arg[min(i + count, size - 1)], the last lane is repeated */
+    friend inline vec shift_lanes_down(vec const & arg, unsigned int count)
+    {
+        const __m256d upper = _mm256_permute2f128_pd(arg.data_, arg.data_, 0x11);    /* [a2 a3 | a2 a3] */
+
+        switch (count)
+        {
+        case 0:
+            return arg;
+
+        case 1:
+            return _mm256_shuffle_pd(arg.data_, upper, 0xd);                    /* [a1 a2 | a3 a3] */
+
+        case 2:
+            return _mm256_permute_pd(upper, 0xe);                               /* [a2 a3 | a3 a3] */
+
+        default:
+            return _mm256_permute_pd(upper, 0xf);
+        }
+    }
+    /* @} */
+
     /* @{ */
     /** unary functions */
     friend inline vec abs(vec const & arg)
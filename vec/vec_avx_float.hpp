@@ -151,6 +151,13 @@ public:
         data_ = _mm256_castps128_ps256(_mm_load_ss(data));
     }
 
+#ifdef __AVX2__
+    void gather(const float * base, const int * indices)
+    {
+        data_ = _mm256_i32gather_ps(base, _mm256_loadu_si256((const __m256i*)indices), 4);
+    }
+#endif
+
     void store(float * dest) const
     {
         _mm256_storeu_ps(dest, data_);
@@ -331,6 +338,87 @@ public:
 
     /* @} */
 
+    /* @{ */
+    /** shuffles */
+
+    /* low = [lhs[0], rhs[0], lhs[1], rhs[1], ...], high continues with the upper halves */
+    friend inline void interleave(vec const & lhs, vec const & rhs, vec & low, vec & high)
+    {
+        /* unpack works on 128 bit lanes */
+        const __m256 lower = _mm256_unpacklo_ps(lhs.data_, rhs.data_);      /* [l0 r0 l1 r1 | l4 r4 l5 r5] */
+        const __m256 upper = _mm256_unpackhi_ps(lhs.data_, rhs.data_);      /* [l2 r2 l3 r3 | l6 r6 l7 r7] */
+        low  = _mm256_permute2f128_ps(lower, upper, 0x20);
+        high = _mm256_permute2f128_ps(lower, upper, 0x31);
+    }
+
+    /* inverse of interleave */
+    friend inline void deinterleave(vec const & low, vec const & high, vec & lhs, vec & rhs)
+    {
+        const __m256 lower = _mm256_permute2f128_ps(low.data_, high.data_, 0x20);  /* [l0 r0 l1 r1 | l4 r4 l5 r5] */
+        const __m256 upper = _mm256_permute2f128_ps(low.data_, high.data_, 0x31);  /* [l2 r2 l3 r3 | l6 r6 l7 r7] */
+        lhs = _mm256_shuffle_ps(lower, upper, _MM_SHUFFLE(2, 0, 2, 0));
+        rhs = _mm256_shuffle_ps(lower, upper, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+
+    /* lane i of the result is arg[max(i - count, 0)], lane 0 is repeated.
+     * count should be a compile-time constant, so that the switch folds. the lanes are shuffled within
+     * the 128 bit halves, the lanes crossing the halves are blended in from the duplicated lower half */
+    friend inline vec shift_lanes_up(vec const & arg, unsigned int count)
+    {
+        const __m256 lower = _mm256_permute2f128_ps(arg.data_, arg.data_, 0x00);    /* [a0 a1 a2 a3 | a0 a1 a2 a3] */
+
+        switch (count)
+        {
+        case 0:
+            return arg;
+
+        case 1:
+            return _mm256_blend_ps(_mm256_permute_ps(arg.data_, _MM_SHUFFLE(2, 1, 0, 0)),
+                                   _mm256_permute_ps(lower, _MM_SHUFFLE(3, 3, 3, 3)), 0x10);
+
+        case 2:
+            return _mm256_blend_ps(_mm256_permute_ps(arg.data_, _MM_SHUFFLE(1, 0, 0, 0)),
+                                   _mm256_permute_ps(lower, _MM_SHUFFLE(3, 2, 3, 2)), 0x30);
+
+        case 4:
+            return _mm256_blend_ps(_mm256_permute_ps(lower, _MM_SHUFFLE(0, 0, 0, 0)), lower, 0xf0);
+
+        default:
+            if (count >= 7)
+                return _mm256_permute_ps(lower, _MM_SHUFFLE(0, 0, 0, 0));
+            return base::shift_lanes_up(arg.data_, count);
+        }
+    }
+
+    /* lane i of the result is arg[min(i + count, size - 1)], the last lane is repeated */
+    friend inline vec shift_lanes_down(vec const & arg, unsigned int count)
+    {
+        const __m256 upper = _mm256_permute2f128_ps(arg.data_, arg.data_, 0x11);    /* [a4 a5 a6 a7 | a4 a5 a6 a7] */
+
+        switch (count)
+        {
+        case 0:
+            return arg;
+
+        case 1:
+            return _mm256_blend_ps(_mm256_permute_ps(arg.data_, _MM_SHUFFLE(3, 3, 2, 1)),
+                                   _mm256_permute_ps(upper, _MM_SHUFFLE(0, 0, 0, 0)), 0x08);
+
+        case 2:
+            return _mm256_blend_ps(_mm256_permute_ps(arg.data_, _MM_SHUFFLE(3, 3, 3, 2)),
+                                   _mm256_permute_ps(upper, _MM_SHUFFLE(1, 0, 1, 0)), 0x0c);
+
+        case 4:
+            return _mm256_blend_ps(upper, _mm256_permute_ps(upper, _MM_SHUFFLE(3, 3, 3, 3)), 0xf0);
+
+        default:
+            if (count >= 7)
+                return _mm256_permute_ps(upper, _MM_SHUFFLE(3, 3, 3, 3));
+            return base::shift_lanes_down(arg.data_, count);
+        }
+    }
+    /* @} */
+
     /* @{ */
     /** unary functions */
     friend inline vec abs(vec const & arg)
@@ -493,6 +581,41 @@ public:
         return int_vec(int_val);
     }
     /* @} */
+
+    /* @{ */
+    /** integer io */
+    void load_int16(const int16_t * src)
+    {
+        data_ = int_vec::load_int16(src).convert_to_float();
+    }
+
+    void load_int32(const int32_t * src)
+    {
+        data_ = int_vec::load_int32(src).convert_to_float();
+    }
+
+    void store_int16(int16_t * dest) const
+    {
+        truncate_to_int().store_int16(dest);
+    }
+
+    void store_int32(int32_t * dest) const
+    {
+        truncate_to_int().store_int32(dest);
+    }
+
+#ifdef __SSSE3__
+    void load_int24(const uint8_t * src)
+    {
+        data_ = int_vec::load_int24(src).convert_to_float();
+    }
+
+    void store_int24(uint8_t * dest) const
+    {
+        truncate_to_int().store_int24(dest);
+    }
+#endif
+    /* @} */
 };
 
 } /* namespace nova */
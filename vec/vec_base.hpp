@@ -98,6 +98,15 @@ public:
         load(data);
     }
 
+    /* load base[indices[0]] ... base[indices[size-1]] */
+    void gather(const WrappedType * base, const int * indices)
+    {
+        cast_unit u;
+        for (int i = 0; i != size; ++i)
+            u.f[i] = base[indices[i]];
+        data_ = u.vec;
+    }
+
     void store(WrappedType * dest) const
     {
         cast_unit u;
@@ -122,6 +131,70 @@ public:
     }
     /* @} */
 
+    /* @{ */
+    /** integer io
+     *
+     *  load size integer values and convert them to WrappedType, or convert to integers and store.
+     *  int24 values are packed little-endian 3-byte values. the stored values must be integral and
+     *  in the range of the integer type. the integer buffers do not need to be aligned.
+     */
+    void load_int16(const int16_t * src)
+    {
+        cast_unit u;
+        for (int i = 0; i != size; ++i)
+            u.f[i] = WrappedType(src[i]);
+        data_ = u.vec;
+    }
+
+    void load_int24(const uint8_t * src)
+    {
+        cast_unit u;
+        for (int i = 0; i != size; ++i) {
+            const uint8_t * sample = src + 3 * i;
+            const uint32_t shifted = (uint32_t(sample[0]) << 8) | (uint32_t(sample[1]) << 16) | (uint32_t(sample[2]) << 24);
+            u.f[i] = WrappedType(int32_t(shifted) >> 8);
+        }
+        data_ = u.vec;
+    }
+
+    void load_int32(const int32_t * src)
+    {
+        cast_unit u;
+        for (int i = 0; i != size; ++i)
+            u.f[i] = WrappedType(src[i]);
+        data_ = u.vec;
+    }
+
+    void store_int16(int16_t * dest) const
+    {
+        cast_unit u;
+        u.vec = data_;
+        for (int i = 0; i != size; ++i)
+            dest[i] = int16_t(u.f[i]);
+    }
+
+    void store_int24(uint8_t * dest) const
+    {
+        cast_unit u;
+        u.vec = data_;
+        for (int i = 0; i != size; ++i) {
+            const int32_t value = int32_t(u.f[i]);
+            uint8_t * sample = dest + 3 * i;
+            sample[0] = uint8_t(value);
+            sample[1] = uint8_t(value >> 8);
+            sample[2] = uint8_t(value >> 16);
+        }
+    }
+
+    void store_int32(int32_t * dest) const
+    {
+        cast_unit u;
+        u.vec = data_;
+        for (int i = 0; i != size; ++i)
+            dest[i] = int32_t(u.f[i]);
+    }
+    /* @} */
+
 
     /* @{ */
     /** element access */
@@ -306,6 +379,7 @@ protected:
     DEFINE_UNARY_STATIC(log2, detail::log2)
     DEFINE_UNARY_STATIC(log10, detail::log10)
     DEFINE_UNARY_STATIC(exp, detail::exp)
+    DEFINE_UNARY_STATIC(sqrt, detail::sqrt)
     DEFINE_UNARY_STATIC(signed_sqrt, detail::signed_sqrt)
 
     DEFINE_UNARY_STATIC(round, detail::round)
@@ -327,6 +401,54 @@ protected:
 
     DEFINE_UNARY_STATIC(undenormalize, detail::undenormalize)
 
+    static void interleave(VecType const & lhs, VecType const & rhs, VecType & low, VecType & high)
+    {
+        cast_unit l, r, lo, hi;
+        l.vec = lhs;
+        r.vec = rhs;
+        for (int i = 0; i != size / 2; ++i) {
+            lo.f[2*i]   = l.f[i];
+            lo.f[2*i+1] = r.f[i];
+            hi.f[2*i]   = l.f[size/2 + i];
+            hi.f[2*i+1] = r.f[size/2 + i];
+        }
+        low = lo.vec;
+        high = hi.vec;
+    }
+
+    static void deinterleave(VecType const & low, VecType const & high, VecType & lhs, VecType & rhs)
+    {
+        cast_unit l, r, lo, hi;
+        lo.vec = low;
+        hi.vec = high;
+        for (int i = 0; i != size / 2; ++i) {
+            l.f[i]          = lo.f[2*i];
+            r.f[i]          = lo.f[2*i+1];
+            l.f[size/2 + i] = hi.f[2*i];
+            r.f[size/2 + i] = hi.f[2*i+1];
+        }
+        lhs = l.vec;
+        rhs = r.vec;
+    }
+
+    static VecType shift_lanes_up(VecType const & arg, unsigned int count)
+    {
+        cast_unit u, ret;
+        u.vec = arg;
+        for (int i = 0; i != size; ++i)
+            ret.f[i] = u.f[i > int(count) ? i - int(count) : 0];
+        return ret.vec;
+    }
+
+    static VecType shift_lanes_down(VecType const & arg, unsigned int count)
+    {
+        cast_unit u, ret;
+        u.vec = arg;
+        for (int i = 0; i != size; ++i)
+            ret.f[i] = u.f[i + count < unsigned(size) ? i + count : size - 1];
+        return ret.vec;
+    }
+
 public:
     WrappedType horizontal_min(void) const
     {
@@ -138,6 +138,29 @@ public:
     NOVA_SIMD_DELEGATE_BINARY_TO_BASE(min_)
     /* @} */
 
+    /* @{ */
+    /** shuffles */
+    friend inline void interleave(vec const & lhs, vec const & rhs, vec & low, vec & high)
+    {
+        base::interleave(lhs.data_, rhs.data_, low.data_, high.data_);
+    }
+
+    friend inline void deinterleave(vec const & low, vec const & high, vec & lhs, vec & rhs)
+    {
+        base::deinterleave(low.data_, high.data_, lhs.data_, rhs.data_);
+    }
+
+    friend inline vec shift_lanes_up(vec const & arg, unsigned int count)
+    {
+        return base::shift_lanes_up(arg.data_, count);
+    }
+
+    friend inline vec shift_lanes_down(vec const & arg, unsigned int count)
+    {
+        return base::shift_lanes_down(arg.data_, count);
+    }
+    /* @} */
+
 
     /* @{ */
     /** rounding functions */
@@ -151,6 +174,22 @@ public:
     /* @{ */
     NOVA_SIMD_DEFINE_MADD
 
+#define RELATIONAL_MASK_OPERATOR(op, opcode)                \
+    friend vec mask_##op(vec const & lhs, vec const & rhs)  \
+    {                                                       \
+        return lhs.base::operator opcode(rhs);              \
+    }
+
+    RELATIONAL_MASK_OPERATOR(lt, <)
+    RELATIONAL_MASK_OPERATOR(le, <=)
+    RELATIONAL_MASK_OPERATOR(gt, >)
+    RELATIONAL_MASK_OPERATOR(ge, >=)
+    RELATIONAL_MASK_OPERATOR(eq, ==)
+    RELATIONAL_MASK_OPERATOR(neq, !=)
+
+#undef RELATIONAL_MASK_OPERATOR
+
+    /* masks are 0 or 1, so select tests for non-zero values */
     friend inline vec select(vec lhs, vec rhs, vec bitmask)
     {
         vec ret;
@@ -182,6 +221,7 @@ public:
 
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(tanh)
 
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(sqrt)
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(signed_sqrt)
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(undenormalize)
     /* @} */
@@ -97,6 +97,16 @@ public:
         return int_vec_altivec (vec_and(lhs.data_, rhs.data_));
     }
 
+    friend int_vec_altivec operator|(int_vec_altivec const & lhs, int_vec_altivec const & rhs)
+    {
+        return int_vec_altivec (vec_or(lhs.data_, rhs.data_));
+    }
+
+    friend int_vec_altivec operator^(int_vec_altivec const & lhs, int_vec_altivec const & rhs)
+    {
+        return int_vec_altivec (vec_xor(lhs.data_, rhs.data_));
+    }
+
     friend inline int_vec_altivec andnot(int_vec_altivec const & lhs, int_vec_altivec const & rhs)
     {
         return int_vec_altivec(vec_andc(lhs.data_, rhs.data_));
@@ -116,7 +126,7 @@ public:
 
     inline fvec convert_to_float(void) const
     {
-        return vec_ctf(data_, 0);
+        return vec_ctf((__vector signed int)data_, 0);
     }
 };
 
@@ -86,6 +86,18 @@ struct int_vec_avx
                                         _mm256_castsi256_ps(rhs.data_)));
     }
 
+    friend int_vec_avx operator|(int_vec_avx const & lhs, int_vec_avx const & rhs)
+    {
+        return int_vec_avx(_mm256_or_ps(_mm256_castsi256_ps(lhs.data_),
+                                        _mm256_castsi256_ps(rhs.data_)));
+    }
+
+    friend int_vec_avx operator^(int_vec_avx const & lhs, int_vec_avx const & rhs)
+    {
+        return int_vec_avx(_mm256_xor_ps(_mm256_castsi256_ps(lhs.data_),
+                                         _mm256_castsi256_ps(rhs.data_)));
+    }
+
     friend inline int_vec_avx andnot(int_vec_avx const & lhs, int_vec_avx const & rhs)
     {
         return int_vec_avx(_mm256_andnot_ps(_mm256_castsi256_ps(lhs.data_),
@@ -127,6 +139,59 @@ struct int_vec_avx
     {
         return _mm256_cvtepi32_ps(data_);
     }
+
+    /* @{ */
+    /** integer io, the buffers do not need to be aligned */
+    static inline int_vec_avx load_int16(const int16_t * src)
+    {
+        return combine(int_vec_sse2::load_int16(src), int_vec_sse2::load_int16(src + 4));
+    }
+
+    static inline int_vec_avx load_int32(const int32_t * src)
+    {
+        return _mm256_loadu_si256((const __m256i*)src);
+    }
+
+    // saturate to int16
+    inline void store_int16(int16_t * dest) const
+    {
+        _mm_storeu_si128((__m128i*)dest, _mm_packs_epi32(low(), high()));
+    }
+
+    inline void store_int32(int32_t * dest) const
+    {
+        _mm256_storeu_si256((__m256i*)dest, data_);
+    }
+
+#ifdef __SSSE3__
+    static inline int_vec_avx load_int24(const uint8_t * src)
+    {
+        return combine(int_vec_sse2::load_int24(src), int_vec_sse2::load_int24(src + 12));
+    }
+
+    inline void store_int24(uint8_t * dest) const
+    {
+        int_vec_sse2(low()).store_int24(dest);
+        int_vec_sse2(high()).store_int24(dest + 12);
+    }
+#endif
+    /* @} */
+
+private:
+    static inline int_vec_avx combine(__m128i low, __m128i high)
+    {
+        return _mm256_insertf128_si256(_mm256_castsi128_si256(low), high, 1);
+    }
+
+    inline __m128i low(void) const
+    {
+        return _mm256_castsi256_si128(data_);
+    }
+
+    inline __m128i high(void) const
+    {
+        return _mm256_extractf128_si256(data_, 1);
+    }
 };
 
 
@@ -20,8 +20,12 @@
 #ifndef VEC_INT_NEON_HPP
 #define VEC_INT_NEON_HPP
 
+#include <cstring>
+
 #include <arm_neon.h>
 
+#include <stdint.h>
+
 namespace nova {
 namespace detail {
 
@@ -80,6 +84,16 @@ struct int_vec_neon
         return vandq_u32(lhs.data_, rhs.data_);
     }
 
+    friend int_vec_neon operator|(int_vec_neon const & lhs, int_vec_neon const & rhs)
+    {
+        return vorrq_u32(lhs.data_, rhs.data_);
+    }
+
+    friend int_vec_neon operator^(int_vec_neon const & lhs, int_vec_neon const & rhs)
+    {
+        return veorq_u32(lhs.data_, rhs.data_);
+    }
+
     friend inline int_vec_neon andnot(int_vec_neon const & lhs, int_vec_neon const & rhs)
     {
         return vandq_u32(lhs.data_, vmvnq_u32(rhs.data_));
@@ -101,6 +115,67 @@ struct int_vec_neon
     {
         return vcvtq_f32_s32(vreinterpretq_s32_u32(data_));
     }
+
+    /* @{ */
+    /** integer io, the buffers do not need to be aligned */
+
+    // sign-extend 4 int16 values
+    static inline int_vec_neon load_int16(const int16_t * src)
+    {
+        return vreinterpretq_u32_s32(vmovl_s16(vld1_s16(src)));
+    }
+
+    // 4 packed little-endian 3-byte values: look up each sample into the upper bytes of its lane
+    // and shift it down arithmetically. out-of-range table indices yield zero bytes
+    static inline int_vec_neon load_int24(const uint8_t * src)
+    {
+        uint32_t tail;
+        std::memcpy(&tail, src + 8, sizeof(tail));
+
+        uint8x8x2_t bytes;
+        bytes.val[0] = vld1_u8(src);
+        bytes.val[1] = vreinterpret_u8_u32(vdup_n_u32(tail));
+
+        static const uint8_t low_indices[8]  = {255, 0, 1, 2, 255, 3, 4, 5};
+        static const uint8_t high_indices[8] = {255, 6, 7, 8, 255, 9, 10, 11};
+        uint8x16_t shuffled = vcombine_u8(vtbl2_u8(bytes, vld1_u8(low_indices)),
+                                          vtbl2_u8(bytes, vld1_u8(high_indices)));
+
+        return vreinterpretq_u32_s32(vshrq_n_s32(vreinterpretq_s32_u8(shuffled), 8));
+    }
+
+    static inline int_vec_neon load_int32(const int32_t * src)
+    {
+        return vreinterpretq_u32_s32(vld1q_s32(src));
+    }
+
+    // saturate to int16
+    inline void store_int16(int16_t * dest) const
+    {
+        vst1_s16(dest, vqmovn_s32(vreinterpretq_s32_u32(data_)));
+    }
+
+    // store the lower 3 bytes of each lane
+    inline void store_int24(uint8_t * dest) const
+    {
+        uint8x16_t lanes = vreinterpretq_u8_u32(data_);
+        uint8x8x2_t bytes;
+        bytes.val[0] = vget_low_u8(lanes);
+        bytes.val[1] = vget_high_u8(lanes);
+
+        static const uint8_t low_indices[8]  = {0, 1, 2, 4, 5, 6, 8, 9};
+        static const uint8_t high_indices[8] = {10, 12, 13, 14, 255, 255, 255, 255};
+        vst1_u8(dest, vtbl2_u8(bytes, vld1_u8(low_indices)));
+
+        const uint32_t tail = vget_lane_u32(vreinterpret_u32_u8(vtbl2_u8(bytes, vld1_u8(high_indices))), 0);
+        std::memcpy(dest + 8, &tail, sizeof(tail));
+    }
+
+    inline void store_int32(int32_t * dest) const
+    {
+        vst1q_s32(dest, vreinterpretq_s32_u32(data_));
+    }
+    /* @} */
 };
 
 }
@@ -20,8 +20,15 @@
 #ifndef VEC_INT_SSE_HPP
 #define VEC_INT_SSE_HPP
 
+#include <cstring>
+
 #include <emmintrin.h>
 
+#ifdef __SSSE3__
+#include <tmmintrin.h>
+#endif
+
+#include <stdint.h>
 
 namespace nova {
 namespace detail {
@@ -82,6 +89,16 @@ struct int_vec_sse2
         return ret;
     }
 
+    friend int_vec_sse2 operator|(int_vec_sse2 const & lhs, int_vec_sse2 const & rhs)
+    {
+        return int_vec_sse2(_mm_or_si128(lhs.data_, rhs.data_));
+    }
+
+    friend int_vec_sse2 operator^(int_vec_sse2 const & lhs, int_vec_sse2 const & rhs)
+    {
+        return int_vec_sse2(_mm_xor_si128(lhs.data_, rhs.data_));
+    }
+
     friend inline int_vec_sse2 andnot(int_vec_sse2 const & lhs, int_vec_sse2 const & rhs)
     {
         return int_vec_sse2(_mm_andnot_si128(lhs.data_, rhs.data_));
@@ -105,6 +122,58 @@ struct int_vec_sse2
     {
         return _mm_cvtepi32_ps(data_);
     }
+
+    /* @{ */
+    /** integer io, the buffers do not need to be aligned */
+
+    // sign-extend 4 int16 values
+    static inline int_vec_sse2 load_int16(const int16_t * src)
+    {
+        __m128i packed = _mm_loadl_epi64((const __m128i*)src);
+        return _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+    }
+
+    static inline int_vec_sse2 load_int32(const int32_t * src)
+    {
+        return _mm_loadu_si128((const __m128i*)src);
+    }
+
+    // saturate to int16
+    inline void store_int16(int16_t * dest) const
+    {
+        _mm_storel_epi64((__m128i*)dest, _mm_packs_epi32(data_, data_));
+    }
+
+    inline void store_int32(int32_t * dest) const
+    {
+        _mm_storeu_si128((__m128i*)dest, data_);
+    }
+
+#ifdef __SSSE3__
+    // 4 packed little-endian 3-byte values: shuffle each sample to the upper bytes of its lane and
+    // shift it down arithmetically
+    static inline int_vec_sse2 load_int24(const uint8_t * src)
+    {
+        int32_t tail;
+        std::memcpy(&tail, src + 8, sizeof(tail));
+        __m128i bytes = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)src), _mm_cvtsi32_si128(tail));
+
+        const __m128i shuffle = _mm_setr_epi8(-1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11);
+        return _mm_srai_epi32(_mm_shuffle_epi8(bytes, shuffle), 8);
+    }
+
+    // store the lower 3 bytes of each lane
+    inline void store_int24(uint8_t * dest) const
+    {
+        const __m128i shuffle = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+        __m128i bytes = _mm_shuffle_epi8(data_, shuffle);
+
+        _mm_storel_epi64((__m128i*)dest, bytes);
+        const int32_t tail = _mm_cvtsi128_si32(_mm_srli_si128(bytes, 8));
+        std::memcpy(dest + 8, &tail, sizeof(tail));
+    }
+#endif
+    /* @} */
 };
 
 }
@@ -368,6 +368,69 @@ public:
 
     /* @} */
 
+    /* @{ */
+    /** shuffles */
+
+    /* low = [lhs[0], rhs[0], lhs[1], rhs[1], ...], high continues with the upper halves */
+    friend inline void interleave(vec const & lhs, vec const & rhs, vec & low, vec & high)
+    {
+        const float32x4x2_t zipped = vzipq_f32(lhs.data_, rhs.data_);
+        low  = zipped.val[0];
+        high = zipped.val[1];
+    }
+
+    /* inverse of interleave */
+    friend inline void deinterleave(vec const & low, vec const & high, vec & lhs, vec & rhs)
+    {
+        const float32x4x2_t unzipped = vuzpq_f32(low.data_, high.data_);
+        lhs = unzipped.val[0];
+        rhs = unzipped.val[1];
+    }
+
+    /* lane i of the result is arg[max(i - count, 0)], lane 0 is repeated.
+     * count should be a compile-time constant, so that the switch folds to a single vext */
+    friend inline vec shift_lanes_up(vec const & arg, unsigned int count)
+    {
+        const float32x4_t first = vdupq_lane_f32(vget_low_f32(arg.data_), 0);
+
+        switch (count)
+        {
+        case 0:
+            return arg;
+
+        case 1:
+            return vextq_f32(first, arg.data_, 3);
+
+        case 2:
+            return vextq_f32(first, arg.data_, 2);
+
+        default:
+            return first;
+        }
+    }
+
+    /* lane i of the result is arg[min(i + count, size - 1)], the last lane is repeated */
+    friend inline vec shift_lanes_down(vec const & arg, unsigned int count)
+    {
+        const float32x4_t last = vdupq_lane_f32(vget_high_f32(arg.data_), 1);
+
+        switch (count)
+        {
+        case 0:
+            return arg;
+
+        case 1:
+            return vextq_f32(arg.data_, last, 1);
+
+        case 2:
+            return vextq_f32(arg.data_, last, 2);
+
+        default:
+            return last;
+        }
+    }
+    /* @} */
+
     /* @{ */
     /** unary functions */
     friend inline vec abs(vec const & arg)
@@ -489,6 +552,39 @@ public:
         return int_vec(vreinterpretq_u32_s32(vcvtq_s32_f32(data_)));
     }
 
+    /* @{ */
+    /** integer io */
+    void load_int16(const int16_t * src)
+    {
+        data_ = int_vec::load_int16(src).convert_to_float();
+    }
+
+    void load_int32(const int32_t * src)
+    {
+        data_ = int_vec::load_int32(src).convert_to_float();
+    }
+
+    void store_int16(int16_t * dest) const
+    {
+        truncate_to_int().store_int16(dest);
+    }
+
+    void store_int32(int32_t * dest) const
+    {
+        truncate_to_int().store_int32(dest);
+    }
+
+    void load_int24(const uint8_t * src)
+    {
+        data_ = int_vec::load_int24(src).convert_to_float();
+    }
+
+    void store_int24(uint8_t * dest) const
+    {
+        truncate_to_int().store_int24(dest);
+    }
+    /* @} */
+
     float horizontal_min(void) const
     {
         float32x2_t high = vget_high_f32(data_);
@@ -437,6 +437,63 @@ public:
 
     /* @} */
 
+    /* @{ */
+    /** shuffles */
+
+    /* low = [lhs[0], rhs[0], lhs[1], rhs[1], ...], high continues with the upper halves */
+    friend inline void interleave(vec const & lhs, vec const & rhs, vec & low, vec & high)
+    {
+        low  = _mm_unpacklo_ps(lhs.data_, rhs.data_);
+        high = _mm_unpackhi_ps(lhs.data_, rhs.data_);
+    }
+
+    /* inverse of interleave */
+    friend inline void deinterleave(vec const & low, vec const & high, vec & lhs, vec & rhs)
+    {
+        lhs = _mm_shuffle_ps(low.data_, high.data_, _MM_SHUFFLE(2, 0, 2, 0));
+        rhs = _mm_shuffle_ps(low.data_, high.data_, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+
+    /* lane i of the result is arg[max(i - count, 0)], lane 0 is repeated.
+     * count should be a compile-time constant, so that the switch folds to a single shuffle */
+    friend inline vec shift_lanes_up(vec const & arg, unsigned int count)
+    {
+        switch (count)
+        {
+        case 0:
+            return arg;
+
+        case 1:
+            return _mm_shuffle_ps(arg.data_, arg.data_, _MM_SHUFFLE(2, 1, 0, 0));
+
+        case 2:
+            return _mm_shuffle_ps(arg.data_, arg.data_, _MM_SHUFFLE(1, 0, 0, 0));
+
+        default:
+            return _mm_shuffle_ps(arg.data_, arg.data_, _MM_SHUFFLE(0, 0, 0, 0));
+        }
+    }
+
+    /* lane i of the result is arg[min(i + count, size - 1)], the last lane is repeated */
+    friend inline vec shift_lanes_down(vec const & arg, unsigned int count)
+    {
+        switch (count)
+        {
+        case 0:
+            return arg;
+
+        case 1:
+            return _mm_shuffle_ps(arg.data_, arg.data_, _MM_SHUFFLE(3, 3, 2, 1));
+
+        case 2:
+            return _mm_shuffle_ps(arg.data_, arg.data_, _MM_SHUFFLE(3, 3, 3, 2));
+
+        default:
+            return _mm_shuffle_ps(arg.data_, arg.data_, _MM_SHUFFLE(3, 3, 3, 3));
+        }
+    }
+    /* @} */
+
     /* @{ */
     /** unary functions */
     friend inline vec abs(vec const & arg)
@@ -679,6 +736,41 @@ public:
     }
 
     /* @} */
+
+    /* @{ */
+    /** integer io */
+    void load_int16(const int16_t * src)
+    {
+        data_ = int_vec::load_int16(src).convert_to_float();
+    }
+
+    void load_int32(const int32_t * src)
+    {
+        data_ = int_vec::load_int32(src).convert_to_float();
+    }
+
+    void store_int16(int16_t * dest) const
+    {
+        truncate_to_int().store_int16(dest);
+    }
+
+    void store_int32(int32_t * dest) const
+    {
+        truncate_to_int().store_int32(dest);
+    }
+
+#ifdef __SSSE3__
+    void load_int24(const uint8_t * src)
+    {
+        data_ = int_vec::load_int24(src).convert_to_float();
+    }
+
+    void store_int24(uint8_t * dest) const
+    {
+        truncate_to_int().store_int24(dest);
+    }
+#endif
+    /* @} */
 #endif // __SSE2__
 };
 
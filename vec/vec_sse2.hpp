@@ -21,6 +21,7 @@
 #define VEC_SSE2_HPP
 
 #include <algorithm>
+#include <cstring>
 
 #include <xmmintrin.h>
 #include <emmintrin.h>
@@ -174,6 +175,34 @@ public:
 
     /* @} */
 
+    /* @{ */
+    /** integer io, int24 uses the generic implementation of vec_base */
+    void load_int16(const int16_t * src)
+    {
+        int32_t packed;
+        std::memcpy(&packed, src, sizeof(packed));
+        __m128i values = _mm_cvtsi32_si128(packed);
+        data_ = _mm_cvtepi32_pd(_mm_srai_epi32(_mm_unpacklo_epi16(values, values), 16));
+    }
+
+    void load_int32(const int32_t * src)
+    {
+        data_ = _mm_cvtepi32_pd(_mm_loadl_epi64((const __m128i*)src));
+    }
+
+    void store_int16(int16_t * dest) const
+    {
+        __m128i values = _mm_cvttpd_epi32(data_);
+        const int32_t packed = _mm_cvtsi128_si32(_mm_packs_epi32(values, values));
+        std::memcpy(dest, &packed, sizeof(packed));
+    }
+
+    void store_int32(int32_t * dest) const
+    {
+        _mm_storel_epi64((__m128i*)dest, _mm_cvttpd_epi32(data_));
+    }
+    /* @} */
+
     /* @{ */
     /** element access */
 
@@ -307,6 +336,36 @@ public:
 
     /* @} */
 
+    /* @{ */
+    /** shuffles */
+
+    /* low = [lhs[0], rhs[0], lhs[1], rhs[1], ...], high continues with the upper halves */
+    friend inline void interleave(vec const & lhs, vec const & rhs, vec & low, vec & high)
+    {
+        low  = _mm_unpacklo_pd(lhs.data_, rhs.data_);
+        high = _mm_unpackhi_pd(lhs.data_, rhs.data_);
+    }
+
+    /* inverse of interleave */
+    friend inline void deinterleave(vec const & low, vec const & high, vec & lhs, vec & rhs)
+    {
+        lhs = _mm_unpacklo_pd(low.data_, high.data_);
+        rhs = _mm_unpackhi_pd(low.data_, high.data_);
+    }
+
+    /* lane i of the result is arg[max(i - count, 0)], lane 0 is repeated */
+    friend inline vec shift_lanes_up(vec const & arg, unsigned int count)
+    {
+        return count ? vec(_mm_unpacklo_pd(arg.data_, arg.data_)) : arg;
+    }
+
+    /* lane i of the result is arg[min(i + count, size - 1)], the last lane is repeated */
+    friend inline vec shift_lanes_down(vec const & arg, unsigned int count)
+    {
+        return count ? vec(_mm_unpackhi_pd(arg.data_, arg.data_)) : arg;
+    }
+    /* @} */
+
     /* @{ */
     /** unary functions */
     friend inline vec abs(vec const & arg)